@@ -26,6 +26,8 @@
  *
  */
 
+#pragma once
+
 mpf_class Rdot(int64_t const n, mpf_class *dx, int64_t const incx, mpf_class *dy, int64_t const incy) {
     mpf_class return_value = 0.0;
     return_value = 0.0;
@@ -40,11 +40,10 @@ using namespace gmpxx;
 #endif
 
 #include "Rdot.hpp"
+#include "../Rnuma.hpp"
 
 #define MFLOPS 1e+6
 
-gmp_randstate_t state;
-
 void _Rdot(int64_t n, mpf_t *dx, int64_t incx, mpf_t *dy, int64_t incy, mpf_t *ans) {
     if (incx != 1 || incy != 1) {
         std::cerr << "Increments other than 1 are not supported." << std::endl;
@@ -76,23 +75,7 @@ void _Rdot(int64_t n, mpf_t *dx, int64_t incx, mpf_t *dy, int64_t incy, mpf_t *a
     }
 }
 
-void init_mpf_vec(mpf_t *vec, int n, int prec) {
-    for (int i = 0; i < n; i++) {
-        mpf_init2(vec[i], prec);
-        mpf_urandomb(vec[i], state, prec);
-    }
-}
-
-void clear_mpf_vec(mpf_t *vec, int n) {
-    for (int i = 0; i < n; i++) {
-        mpf_clear(vec[i]);
-    }
-}
-
 int main(int argc, char **argv) {
-    gmp_randinit_default(state);
-    gmp_randseed_ui(state, 42);
-
     if (argc != 3) {
         std::cerr << "Usage: " << argv[0] << " <vector size> <precision>" << std::endl;
         return 1;
@@ -111,8 +94,10 @@ int main(int argc, char **argv) {
 
     mpf_init2(dot_product, prec);
     mpf_init2(_ans, prec);
-    init_mpf_vec(vec1, N, prec);
-    init_mpf_vec(vec2, N, prec);
+    // Initialize and fill the vectors with the kernel's static partition,
+    // so each thread first-touches the limbs it reads
+    Rnuma_init_random(vec1, N, 0, 1, prec);
+    Rnuma_init_random(vec2, N, 0, 2, prec);
 
     mpf_class *vec1_mpf_class = new mpf_class[N];
     mpf_class *vec2_mpf_class = new mpf_class[N];
@@ -142,8 +127,8 @@ int main(int argc, char **argv) {
     else
         std::cout << "NG" << std::endl;
 
-    clear_mpf_vec(vec1, N);
-    clear_mpf_vec(vec2, N);
+    Rnuma_clear(vec1, N, 0);
+    Rnuma_clear(vec2, N, 0);
     mpf_clear(dot_product);
     delete[] vec1;
     delete[] vec2;
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2026
+ *      Nakata, Maho
+ *      All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ */
+
+// Block-floating-point variant: the vectors are converted to
+// gmpxx::bfp_vector once and the dot product runs on mpn limbs.  The
+// conversion is timed separately from the kernel.  This file needs
+// gmpxx_mkII and is not built against the original gmpxx.
+
+#include <iostream>
+#include <chrono>
+#include <gmp.h>
+
+#include "gmpxx_mkII.h"
+#if !defined ___GMPXX_STRICT_COMPATIBILITY___
+using namespace gmpxx;
+#endif
+
+#include "Rdot.hpp"
+
+#define MFLOPS 1e+6
+
+gmp_randstate_t state;
+
+mpf_class _Rdot(const gmpxx::bfp_vector &dx, const gmpxx::bfp_vector &dy) { return gmpxx::dot(dx, dy); }
+
+void init_mpf_vec(mpf_t *vec, int n, int prec) {
+    for (int i = 0; i < n; i++) {
+        mpf_init2(vec[i], prec);
+        mpf_urandomb(vec[i], state, prec);
+    }
+}
+
+void clear_mpf_vec(mpf_t *vec, int n) {
+    for (int i = 0; i < n; i++) {
+        mpf_clear(vec[i]);
+    }
+}
+
+int main(int argc, char **argv) {
+    gmp_randinit_default(state);
+    gmp_randseed_ui(state, 42);
+
+    if (argc != 3) {
+        std::cerr << "Usage: " << argv[0] << " <vector size> <precision>" << std::endl;
+        return 1;
+    }
+
+    int N = std::atoi(argv[1]);
+    int prec = std::atoi(argv[2]);
+    mpf_set_default_prec(prec);
+    gmpxx::gmpxx_defaults::set_initial_default_prec(prec);
+
+    mpf_t *vec1 = new mpf_t[N];
+    mpf_t *vec2 = new mpf_t[N];
+
+    init_mpf_vec(vec1, N, prec);
+    init_mpf_vec(vec2, N, prec);
+
+    mpf_class *vec1_mpf_class = new mpf_class[N];
+    mpf_class *vec2_mpf_class = new mpf_class[N];
+    mpf_class _ans;
+
+    for (int i = 0; i < N; i++) {
+        vec1_mpf_class[i] = mpf_class(vec1[i]);
+        vec2_mpf_class[i] = mpf_class(vec2[i]);
+    }
+
+    auto convert_start = std::chrono::high_resolution_clock::now();
+    gmpxx::bfp_vector bfp1(vec1_mpf_class, N, prec);
+    gmpxx::bfp_vector bfp2(vec2_mpf_class, N, prec);
+    auto convert_end = std::chrono::high_resolution_clock::now();
+
+    auto start = std::chrono::high_resolution_clock::now();
+    _ans = _Rdot(bfp1, bfp2);
+    auto end = std::chrono::high_resolution_clock::now();
+
+    mpf_class ans = Rdot(N, vec1_mpf_class, 1, vec2_mpf_class, 1);
+
+    std::chrono::duration<double> convert_seconds = convert_end - convert_start;
+    std::chrono::duration<double> elapsed_seconds = end - start;
+    std::cout << "Conversion time: " << convert_seconds.count() << " s" << std::endl;
+    std::cout << "Elapsed time: " << elapsed_seconds.count() << " s" << std::endl;
+    std::cout << "MFLOPS: " << (2.0 * double(N) - 1.0) / elapsed_seconds.count() / MFLOPS << std::endl;
+
+    mpf_class _tmp;
+    _tmp = abs(_ans - ans);
+    std::cout << "DIFF: ";
+    gmp_printf("%.4Fg ", _tmp.get_mpf_t());
+    if (_tmp < 1e-5)
+        std::cout << "OK" << std::endl;
+    else
+        std::cout << "NG" << std::endl;
+
+    clear_mpf_vec(vec1, N);
+    clear_mpf_vec(vec2, N);
+    delete[] vec1;
+    delete[] vec2;
+    delete[] vec1_mpf_class;
+    delete[] vec2_mpf_class;
+
+    return 0;
+}
@@ -40,11 +40,10 @@ using namespace gmpxx;
 #endif
 
 #include "Rdot.hpp"
+#include "../Rnuma.hpp"
 
 #define MFLOPS 1e+6
 
-gmp_randstate_t state;
-
 mpf_class _Rdot(int64_t n, mpf_class *dx, int64_t incx, mpf_class *dy, int64_t incy) {
     int64_t i;
 
@@ -76,23 +75,7 @@ mpf_class _Rdot(int64_t n, mpf_class *dx, int64_t incx, mpf_class *dy, int64_t i
     return temp;
 }
 
-void init_mpf_vec(mpf_t *vec, int n, int prec) {
-    for (int i = 0; i < n; i++) {
-        mpf_init2(vec[i], prec);
-        mpf_urandomb(vec[i], state, prec);
-    }
-}
-
-void clear_mpf_vec(mpf_t *vec, int n) {
-    for (int i = 0; i < n; i++) {
-        mpf_clear(vec[i]);
-    }
-}
-
 int main(int argc, char **argv) {
-    gmp_randinit_default(state);
-    gmp_randseed_ui(state, 42);
-
     if (argc != 3) {
         std::cerr << "Usage: " << argv[0] << " <vector size> <precision>" << std::endl;
         return 1;
@@ -105,24 +88,14 @@ int main(int argc, char **argv) {
     gmpxx::gmpxx_defaults::set_initial_default_prec(prec);
 #endif
 
-    mpf_t *vec1 = new mpf_t[N];
-    mpf_t *vec2 = new mpf_t[N];
-    mpf_t tmp, dot_product;
-
-    mpf_init2(dot_product, prec);
-    mpf_init2(tmp, prec);
-    init_mpf_vec(vec1, N, prec);
-    init_mpf_vec(vec2, N, prec);
-
-    mpf_class *vec1_mpf_class = new mpf_class[N];
-    mpf_class *vec2_mpf_class = new mpf_class[N];
+    // Build and fill the vectors with the kernel's static partition, so
+    // each thread first-touches the limbs it reads
+    mpf_class *vec1_mpf_class = Rnuma_new_mpf_class(N, 0, prec);
+    mpf_class *vec2_mpf_class = Rnuma_new_mpf_class(N, 0, prec);
+    Rnuma_fill_random(vec1_mpf_class, N, 0, 1, prec);
+    Rnuma_fill_random(vec2_mpf_class, N, 0, 2, prec);
     mpf_class _ans;
 
-    for (int i = 0; i < N; i++) {
-        vec1_mpf_class[i] = mpf_class(vec1[i]);
-        vec2_mpf_class[i] = mpf_class(vec2[i]);
-    }
-
     auto start = std::chrono::high_resolution_clock::now();
     _ans = _Rdot(N, vec1_mpf_class, 1, vec2_mpf_class, 1);
     auto end = std::chrono::high_resolution_clock::now();
@@ -142,12 +115,8 @@ int main(int argc, char **argv) {
     else
         std::cout << "NG" << std::endl;
 
-    clear_mpf_vec(vec1, N);
-    clear_mpf_vec(vec2, N);
-    mpf_clear(tmp);
-    mpf_clear(dot_product);
-    delete[] vec1;
-    delete[] vec2;
+    Rnuma_delete_mpf_class(vec1_mpf_class, N, 0);
+    Rnuma_delete_mpf_class(vec2_mpf_class, N, 0);
 
     return 0;
 }
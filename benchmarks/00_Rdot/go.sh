@@ -43,6 +43,14 @@ executables=(
     "Rdot_gmp_kernel_04_orig"
     "Rdot_gmp_kernel_04_mkII"
     "Rdot_gmp_kernel_04_mkII_NOPRECCHANGE"
+    "Rdot_gmp_kernel_05_mkII"
+    "Rdot_gmp_kernel_05_mkII_NOPRECCHANGE"
+    "Rdot_gmp_kernel_05_mkII_GENERIC_LIMBS"
+    "Rdot_gmp_kernel_06_mkII"
+    "Rdot_gmp_kernel_06_mkII_NOPRECCHANGE"
+    "Rdot_gmp_kernel_07_mkII"
+    "Rdot_gmp_kernel_07_mkII_NOPRECCHANGE"
+    "Rdot_gmp_kernel_07_mkII_BATCH_PORTABLE"
     "Rdot_gmp_kernel_openmp_01_orig"
     "Rdot_gmp_kernel_openmp_01_mkII"
     "Rdot_gmp_kernel_openmp_01_mkII_NOPRECCHANGE"
@@ -26,6 +26,8 @@
  *
  */
 
+#pragma once
+
 void Raxpy(int64_t const n, mpf_class const da, mpf_class *dx, int64_t const incx, mpf_class *dy, int64_t const incy) {
     if (n <= 0) {
         return;
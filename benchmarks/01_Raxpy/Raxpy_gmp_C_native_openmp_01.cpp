@@ -40,6 +40,7 @@ using namespace gmpxx;
 #endif
 
 #include "Raxpy.hpp"
+#include "../Rnuma.hpp"
 
 #define MFLOPS 1e+6
 
@@ -68,19 +69,6 @@ void _Raxpy(int64_t n, const mpf_t alpha, mpf_t *x, int64_t incx, mpf_t *y, int6
     }
 }
 
-void init_mpf_vec(mpf_t *vec, int64_t n, int prec) {
-    for (int64_t i = 0; i < n; ++i) {
-        mpf_init2(vec[i], prec);
-        mpf_urandomb(vec[i], state, prec); // 0 <= vec[i] < 1
-    }
-}
-
-void clear_mpf_vec(mpf_t *vec, int64_t n) {
-    for (int64_t i = 0; i < n; ++i) {
-        mpf_clear(vec[i]);
-    }
-}
-
 int main(int argc, char **argv) {
     gmp_randinit_default(state);
     gmp_randseed_ui(state, 42);
@@ -103,8 +91,10 @@ int main(int argc, char **argv) {
     mpf_init2(alpha, prec);
     mpf_urandomb(alpha, state, prec);
 
-    init_mpf_vec(x, N, prec);
-    init_mpf_vec(y, N, prec);
+    // Initialize and fill x and y with the kernel's static partition, so
+    // each thread first-touches the limbs it reads
+    Rnuma_init_random(x, N, 0, 1, prec);
+    Rnuma_init_random(y, N, 0, 2, prec);
 
     mpf_class *x_mpf_class = new mpf_class[N];
     mpf_class *y_mpf_class = new mpf_class[N];
@@ -143,8 +133,8 @@ int main(int argc, char **argv) {
         std::cout << "Result NG" << std::endl;
     }
 
-    clear_mpf_vec(x, N);
-    clear_mpf_vec(y, N);
+    Rnuma_clear(x, N, 0);
+    Rnuma_clear(y, N, 0);
     mpf_clear(alpha);
     delete[] x;
     delete[] y;
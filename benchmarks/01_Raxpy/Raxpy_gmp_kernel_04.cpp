@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2026
+ *      Nakata, Maho
+ *      All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ */
+
+// Transposed batch variant: x and y are converted to gmpxx::mpf_batch once
+// and y += alpha * x runs as one batched fma on the AVX-512 IFMA, AVX2, or
+// portable kernel chosen at run time.  The batched add and mul are also
+// timed against mpf_add and mpf_mul loops over the same values.  This file
+// needs gmpxx_mkII and is not built against the original gmpxx.
+
+#include <iostream>
+#include <chrono>
+
+#include "gmpxx_mkII.h"
+#if !defined ___GMPXX_STRICT_COMPATIBILITY___
+using namespace gmpxx;
+#endif
+
+#include "Raxpy.hpp"
+
+#define MFLOPS 1e+6
+
+gmp_randstate_t state;
+
+void _Raxpy(const mpf_class &alpha, const gmpxx::mpf_batch &x, gmpxx::mpf_batch &y) { y.axpy(alpha, x); }
+
+const char *kernel_name(gmpxx::mpf_batch_kernel kernel) {
+    switch (kernel) {
+    case gmpxx::mpf_batch_kernel::avx512ifma:
+        return "avx512ifma";
+    case gmpxx::mpf_batch_kernel::avx2:
+        return "avx2";
+    default:
+        return "portable";
+    }
+}
+
+int main(int argc, char **argv) {
+    gmp_randclass r(gmp_randinit_default);
+    r.seed(42);
+
+    if (argc != 3) {
+        std::cerr << "Usage: " << argv[0] << " <vector size> <precision>" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    int64_t N = std::atoll(argv[1]);
+    int prec = std::atoi(argv[2]);
+    if (prec > (int)gmpxx::mpf_batch::max_prec) {
+        std::cerr << "mpf_batch supports at most " << gmpxx::mpf_batch::max_prec << " bits" << std::endl;
+        return EXIT_FAILURE;
+    }
+    mpf_set_default_prec(prec);
+    gmpxx::gmpxx_defaults::set_initial_default_prec(prec);
+
+    mpf_class *x = new mpf_class[N];
+    mpf_class *y = new mpf_class[N];
+    mpf_class *yy = new mpf_class[N];
+    mpf_class alpha;
+    alpha = r.get_f(prec);
+
+    for (int64_t i = 0; i < N; ++i) {
+        x[i] = r.get_f(prec);
+        y[i] = r.get_f(prec);
+        yy[i] = y[i];
+    }
+
+    auto convert_start = std::chrono::high_resolution_clock::now();
+    gmpxx::mpf_batch bx(x, (std::size_t)N, prec);
+    gmpxx::mpf_batch by(y, (std::size_t)N, prec);
+    auto convert_end = std::chrono::high_resolution_clock::now();
+
+    // Elementwise add and mul, batched and with one mpf call per element.
+    gmpxx::mpf_batch bz((std::size_t)N, prec, bx.kernel());
+    mpf_class *z = new mpf_class[N];
+    auto batch_add_start = std::chrono::high_resolution_clock::now();
+    bz.add(bx, by);
+    auto batch_mul_start = std::chrono::high_resolution_clock::now();
+    bz.mul(bx, by);
+    auto batch_mul_end = std::chrono::high_resolution_clock::now();
+    for (int64_t i = 0; i < N; ++i) {
+        mpf_add(z[i].get_mpf_t(), x[i].get_mpf_t(), y[i].get_mpf_t());
+    }
+    auto mpf_mul_start = std::chrono::high_resolution_clock::now();
+    for (int64_t i = 0; i < N; ++i) {
+        mpf_mul(z[i].get_mpf_t(), x[i].get_mpf_t(), y[i].get_mpf_t());
+    }
+    auto mpf_mul_end = std::chrono::high_resolution_clock::now();
+    delete[] z;
+
+    auto start = std::chrono::high_resolution_clock::now();
+    _Raxpy(alpha, bx, by);
+    auto end = std::chrono::high_resolution_clock::now();
+
+    by.to_mpf(y);
+    Raxpy(N, alpha, x, 1, yy, 1);
+
+    std::chrono::duration<double> convert_seconds = convert_end - convert_start;
+    std::chrono::duration<double> batch_add_seconds = batch_mul_start - batch_add_start;
+    std::chrono::duration<double> batch_mul_seconds = batch_mul_end - batch_mul_start;
+    std::chrono::duration<double> mpf_add_seconds = mpf_mul_start - batch_mul_end;
+    std::chrono::duration<double> mpf_mul_seconds = mpf_mul_end - mpf_mul_start;
+    std::chrono::duration<double> elapsed_seconds = end - start;
+    double mflops = (2.0 * double(N)) / (elapsed_seconds.count() * MFLOPS);
+
+    std::cout << "Batch kernel: " << kernel_name(bx.kernel()) << std::endl;
+    std::cout << "Conversion time: " << convert_seconds.count() << " s" << std::endl;
+    std::cout << "Batch add time: " << batch_add_seconds.count() << " s" << std::endl;
+    std::cout << "mpf_add time: " << mpf_add_seconds.count() << " s" << std::endl;
+    std::cout << "Batch mul time: " << batch_mul_seconds.count() << " s" << std::endl;
+    std::cout << "mpf_mul time: " << mpf_mul_seconds.count() << " s" << std::endl;
+    std::cout << "Elapsed time: " << elapsed_seconds.count() << " s" << std::endl;
+    std::cout << "MFLOPS: " << mflops << std::endl;
+
+    mpf_class l1_norm = 0;
+    for (int64_t i = 0; i < N; ++i) {
+        mpf_class diff = abs(y[i] - yy[i]);
+        l1_norm += diff;
+    }
+
+    std::cout << "L1 Norm of difference: " << l1_norm;
+    gmp_printf("%.4Fg\n", l1_norm.get_mpf_t());
+
+    mpf_class threshold = 1e-5;
+    if (l1_norm < threshold) {
+        std::cout << "Result OK" << std::endl;
+    } else {
+        std::cout << "Result NG" << std::endl;
+    }
+
+    delete[] x;
+    delete[] y;
+    delete[] yy;
+
+    return EXIT_SUCCESS;
+}
@@ -39,6 +39,7 @@ using namespace gmpxx;
 #endif
 
 #include "Raxpy.hpp"
+#include "../Rnuma.hpp"
 
 #define MFLOPS 1e+6
 
@@ -78,15 +79,17 @@ int main(int argc, char **argv) {
     gmpxx::gmpxx_defaults::set_initial_default_prec(prec);
 #endif
 
-    mpf_class *x = new mpf_class[N];
-    mpf_class *y = new mpf_class[N];
+    // Build and fill x and y with the kernel's schedule(static, 1000), so each
+    // thread first-touches the limbs it reads
+    mpf_class *x = Rnuma_new_mpf_class(N, 1000, prec);
+    mpf_class *y = Rnuma_new_mpf_class(N, 1000, prec);
     mpf_class *yy = new mpf_class[N];
     mpf_class alpha;
     alpha = r.get_f(prec);
 
+    Rnuma_fill_random(x, N, 1000, 1, prec);
+    Rnuma_fill_random(y, N, 1000, 2, prec);
     for (int64_t i = 0; i < N; ++i) {
-        x[i] = r.get_f(prec);
-        y[i] = r.get_f(prec);
         yy[i] = y[i];
     }
 
@@ -118,8 +121,9 @@ int main(int argc, char **argv) {
         std::cout << "Result NG" << std::endl;
     }
 
-    delete[] x;
-    delete[] y;
+    Rnuma_delete_mpf_class(x, N, 1000);
+    Rnuma_delete_mpf_class(y, N, 1000);
+    delete[] yy;
 
     return EXIT_SUCCESS;
 }
@@ -37,6 +37,12 @@ executables=(
     "Raxpy_gmp_kernel_02_orig"
     "Raxpy_gmp_kernel_02_mkII"
     "Raxpy_gmp_kernel_02_mkII_NOPRECCHANGE"
+    "Raxpy_gmp_kernel_03_mkII"
+    "Raxpy_gmp_kernel_03_mkII_NOPRECCHANGE"
+    "Raxpy_gmp_kernel_03_mkII_GENERIC_LIMBS"
+    "Raxpy_gmp_kernel_04_mkII"
+    "Raxpy_gmp_kernel_04_mkII_NOPRECCHANGE"
+    "Raxpy_gmp_kernel_04_mkII_BATCH_PORTABLE"
     "Raxpy_gmp_kernel_openmp_01_orig"
     "Raxpy_gmp_kernel_openmp_01_mkII"
     "Raxpy_gmp_kernel_openmp_01_mkII_NOPRECCHANGE"
@@ -26,6 +26,8 @@
  *
  */
 
+#pragma once
+
 bool Mlsame(const char *a, const char *b) {
     if (toupper(*a) == toupper(*b))
             return true;
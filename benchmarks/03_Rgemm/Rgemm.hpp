@@ -26,6 +26,8 @@
  *
  */
 
+#pragma once
+
 void Mxerbla(const char *srname, int info) {
     fprintf(stderr, " ** On entry to %s parameter number %2d had an illegal value\n", srname, info);
     exit(info);
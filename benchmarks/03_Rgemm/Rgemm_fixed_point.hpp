@@ -0,0 +1,261 @@
+/*
+ * Copyright (c) 2026
+ *      Nakata, Maho
+ *      All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ */
+
+#pragma once
+
+// Fixed-point engine for C = alpha * A * B + beta * C.
+//
+// Each row of A and each column of B is aligned to one shared binary
+// exponent and converted to an integer mantissa.  Dot products are then
+// exact integer sums, so every C entry is rounded once when it is converted
+// back to mpf.  Because the sums are exact, Winograd's inner-product
+// identity
+//
+//   sum_l a_l b_l = sum_t (a_2t + b_2t+1) (a_2t+1 + b_2t) - xi_i - eta_j
+//
+// can be used without the cancellation it suffers in floating point; it
+// halves the number of full-size multiplies.  Rows or columns whose
+// exponent spread exceeds the working precision fall back to the classical
+// mpf loop.
+
+#include <algorithm>
+#include <vector>
+
+// Exponent spread (bits) above which the engine falls back to mpf.
+// Beyond this point the aligned mantissas are more than twice as wide as
+// the mpf operands and the integer path no longer pays off.
+inline long Rgemm_fixed_point_max_spread(long prec) { return prec; }
+
+// Below this precision the Winograd pairing costs as much in additions as
+// it saves in multiplies; plain mpz_addmul accumulation is used instead.
+inline constexpr long Rgemm_fixed_point_winograd_min_prec = 512;
+
+inline constexpr long Rgemm_fixed_point_guard_bits = 64;
+
+inline long Rgemm_fixed_point_exponent(const mpf_class &x) {
+    long e = 0;
+    mpf_get_d_2exp(&e, x.get_mpf_t());
+    return e;
+}
+
+// Shared exponent and spread of a strided vector.  Zero entries do not take
+// part; an all-zero vector reports exponent 0 and spread 0.
+inline void Rgemm_fixed_point_scan(const mpf_class *x, int64_t len, int64_t inc, long &emax, long &spread) {
+    bool found = false;
+    long lo = 0;
+    long hi = 0;
+    for (int64_t l = 0; l < len; ++l) {
+        const mpf_class &v = x[l * inc];
+        if (mpf_sgn(v.get_mpf_t()) == 0) {
+            continue;
+        }
+        long e = Rgemm_fixed_point_exponent(v);
+        if (!found) {
+            lo = hi = e;
+            found = true;
+        } else {
+            lo = std::min(lo, e);
+            hi = std::max(hi, e);
+        }
+    }
+    emax = found ? hi : 0;
+    spread = found ? hi - lo : 0;
+}
+
+// dst[l] = trunc(x[l * inc] * 2^(frac - emax)).
+inline void Rgemm_fixed_point_convert(mpz_class *dst, const mpf_class *x, int64_t len, int64_t inc, long emax, long frac, mpf_t scaled) {
+    long shift = frac - emax;
+    for (int64_t l = 0; l < len; ++l) {
+        if (shift >= 0) {
+            mpf_mul_2exp(scaled, x[l * inc].get_mpf_t(), (mp_bitcnt_t)shift);
+        } else {
+            mpf_div_2exp(scaled, x[l * inc].get_mpf_t(), (mp_bitcnt_t)(-shift));
+        }
+        mpz_set_f(dst[l].get_mpz_t(), scaled);
+    }
+}
+
+inline void Rgemm_classical(int64_t m, int64_t k, int64_t n, const mpf_class &alpha, const mpf_class *A, int64_t lda, const mpf_class *B, int64_t ldb, const mpf_class &beta, mpf_class *C, int64_t ldc) {
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(static)
+#endif
+    for (int64_t j = 0; j < n; ++j) {
+        mpf_class temp, templ;
+        for (int64_t i = 0; i < m; ++i) {
+            C[i + j * ldc] *= beta;
+        }
+        for (int64_t l = 0; l < k; ++l) {
+            temp = alpha;
+            temp *= B[l + j * ldb];
+            for (int64_t i = 0; i < m; ++i) {
+                templ = temp;
+                templ *= A[i + l * lda];
+                C[i + j * ldc] += templ;
+            }
+        }
+    }
+}
+
+// Returns false when the exponent spread forced the classical fallback.
+inline bool Rgemm_fixed_point(int64_t m, int64_t k, int64_t n, const mpf_class &alpha, const mpf_class *A, int64_t lda, const mpf_class *B, int64_t ldb, const mpf_class &beta, mpf_class *C, int64_t ldc) {
+    if (m <= 0 || n <= 0) {
+        return true;
+    }
+    if (k <= 0) {
+        Rgemm_classical(m, k, n, alpha, A, lda, B, ldb, beta, C, ldc);
+        return true;
+    }
+    const long prec = (long)mpf_get_prec(C[0].get_mpf_t());
+
+    std::vector<long> ea(m), eb(n), spread_a(m), spread_b(n);
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(static)
+#endif
+    for (int64_t i = 0; i < m; ++i) {
+        Rgemm_fixed_point_scan(&A[i], k, lda, ea[i], spread_a[i]);
+    }
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(static)
+#endif
+    for (int64_t j = 0; j < n; ++j) {
+        Rgemm_fixed_point_scan(&B[j * ldb], k, 1, eb[j], spread_b[j]);
+    }
+    const long max_spread_a = *std::max_element(spread_a.begin(), spread_a.end());
+    const long max_spread_b = *std::max_element(spread_b.begin(), spread_b.end());
+    if (std::max(max_spread_a, max_spread_b) > Rgemm_fixed_point_max_spread(prec)) {
+        Rgemm_classical(m, k, n, alpha, A, lda, B, ldb, beta, C, ldc);
+        return false;
+    }
+
+    // Every nonzero entry keeps at least prec + guard significant bits.
+    const long frac_a = prec + max_spread_a + Rgemm_fixed_point_guard_bits;
+    const long frac_b = prec + max_spread_b + Rgemm_fixed_point_guard_bits;
+
+    // Rows of A are stored contiguously (row i at Ai[i * k]), columns of B
+    // likewise (column j at Bi[j * k]).
+    std::vector<mpz_class> Ai((size_t)(m * k)), Bi((size_t)(k * n));
+#if defined(_OPENMP)
+#pragma omp parallel
+#endif
+    {
+        mpf_t scaled;
+        mpf_init2(scaled, (mp_bitcnt_t)(std::max(frac_a, frac_b) + prec + Rgemm_fixed_point_guard_bits));
+#if defined(_OPENMP)
+#pragma omp for schedule(static)
+#endif
+        for (int64_t i = 0; i < m; ++i) {
+            Rgemm_fixed_point_convert(&Ai[i * k], &A[i], k, lda, ea[i], frac_a, scaled);
+        }
+#if defined(_OPENMP)
+#pragma omp for schedule(static)
+#endif
+        for (int64_t j = 0; j < n; ++j) {
+            Rgemm_fixed_point_convert(&Bi[j * k], &B[j * ldb], k, 1, eb[j], frac_b, scaled);
+        }
+        mpf_clear(scaled);
+    }
+
+    const bool winograd = prec >= Rgemm_fixed_point_winograd_min_prec && k >= 2;
+    const int64_t half = k / 2;
+    std::vector<mpz_class> xi(winograd ? m : 0), eta(winograd ? n : 0);
+    if (winograd) {
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(static)
+#endif
+        for (int64_t i = 0; i < m; ++i) {
+            const mpz_class *a = &Ai[i * k];
+            for (int64_t t = 0; t < half; ++t) {
+                mpz_addmul(xi[i].get_mpz_t(), a[2 * t].get_mpz_t(), a[2 * t + 1].get_mpz_t());
+            }
+        }
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(static)
+#endif
+        for (int64_t j = 0; j < n; ++j) {
+            const mpz_class *b = &Bi[j * k];
+            for (int64_t t = 0; t < half; ++t) {
+                mpz_addmul(eta[j].get_mpz_t(), b[2 * t].get_mpz_t(), b[2 * t + 1].get_mpz_t());
+            }
+        }
+    }
+
+#if defined(_OPENMP)
+#pragma omp parallel
+#endif
+    {
+        mpz_t acc, s1, s2;
+        mpz_init(acc);
+        mpz_init(s1);
+        mpz_init(s2);
+        mpf_t dot;
+        mpf_init2(dot, (mp_bitcnt_t)(prec + Rgemm_fixed_point_guard_bits));
+#if defined(_OPENMP)
+#pragma omp for schedule(static)
+#endif
+        for (int64_t j = 0; j < n; ++j) {
+            const mpz_class *b = &Bi[j * k];
+            for (int64_t i = 0; i < m; ++i) {
+                const mpz_class *a = &Ai[i * k];
+                if (winograd) {
+                    mpz_add(acc, xi[i].get_mpz_t(), eta[j].get_mpz_t());
+                    mpz_neg(acc, acc);
+                    for (int64_t t = 0; t < half; ++t) {
+                        mpz_add(s1, a[2 * t].get_mpz_t(), b[2 * t + 1].get_mpz_t());
+                        mpz_add(s2, a[2 * t + 1].get_mpz_t(), b[2 * t].get_mpz_t());
+                        mpz_addmul(acc, s1, s2);
+                    }
+                    if (k & 1) {
+                        mpz_addmul(acc, a[k - 1].get_mpz_t(), b[k - 1].get_mpz_t());
+                    }
+                } else {
+                    mpz_set_ui(acc, 0);
+                    for (int64_t l = 0; l < k; ++l) {
+                        mpz_addmul(acc, a[l].get_mpz_t(), b[l].get_mpz_t());
+                    }
+                }
+                // The only rounding of the dot product happens here.
+                mpf_set_z(dot, acc);
+                long shift = (ea[i] - frac_a) + (eb[j] - frac_b);
+                if (shift >= 0) {
+                    mpf_mul_2exp(dot, dot, (mp_bitcnt_t)shift);
+                } else {
+                    mpf_div_2exp(dot, dot, (mp_bitcnt_t)(-shift));
+                }
+                mpf_mul(dot, dot, alpha.get_mpf_t());
+                mpf_class &c = C[i + j * ldc];
+                c *= beta;
+                mpf_add(c.get_mpf_t(), c.get_mpf_t(), dot);
+            }
+        }
+        mpf_clear(dot);
+        mpz_clear(s2);
+        mpz_clear(s1);
+        mpz_clear(acc);
+    }
+    return true;
+}
@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) 2026
+ *      Nakata, Maho
+ *      All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ */
+
+// Precision-tiered variant: at 106 bits or less the matrices are converted
+// to gmpxx::dd_real, at 212 bits or less to gmpxx::qd_real, and the
+// multiply runs on doubles.  Above that the mpf loop of kernel_03 is used.
+// The conversions are timed separately from the kernel.  This file needs
+// gmpxx_mkII and is not built against the original gmpxx.
+
+#include <iostream>
+#include <chrono>
+#include <cstdlib>
+#include <vector>
+
+#include "gmpxx_mkII.h"
+#if !defined ___GMPXX_STRICT_COMPATIBILITY___
+using namespace gmpxx;
+#endif
+
+#include "Rgemm.hpp"
+
+#define MFLOPS 1e+6
+
+// cf. https://netlib.org/lapack/lawnspdf/lawn41.pdf p.120
+double flops_gemm(int k_i, int m_i, int n_i) {
+    double adds, muls, flops;
+    double k, m, n;
+    m = (double)m_i;
+    n = (double)n_i;
+    k = (double)k_i;
+    muls = m * (k + 2) * n;
+    adds = m * k * n;
+    flops = muls + adds;
+    return flops;
+}
+
+// C = alpha * A * B + beta * C in dd_real or qd_real
+template <class T> void _Rgemm(int64_t m, int64_t k, int64_t n, const T &alpha, const T *A, int64_t lda, const T *B, int64_t ldb, const T &beta, T *C, int64_t ldc) {
+    for (int64_t j = 0; j < n; ++j) {
+        for (int64_t i = 0; i < m; ++i) {
+            C[i + j * ldc] *= beta;
+        }
+        for (int64_t l = 0; l < k; ++l) {
+            const T temp = alpha * B[l + j * ldb];
+            for (int64_t i = 0; i < m; ++i) {
+                C[i + j * ldc] += temp * A[i + l * lda];
+            }
+        }
+    }
+}
+
+void _Rgemm(int64_t m, int64_t k, int64_t n, const mpf_class &alpha, const mpf_class *A, int64_t lda, const mpf_class *B, int64_t ldb, const mpf_class &beta, mpf_class *C, int64_t ldc) {
+    for (int64_t j = 0; j < n; ++j) {
+        for (int64_t i = 0; i < m; ++i) {
+            C[i + j * ldc] *= beta;
+        }
+    }
+    mpf_class temp, templ;
+    for (int64_t j = 0; j < n; ++j) {
+        for (int64_t l = 0; l < k; ++l) {
+            temp = alpha;
+            temp *= B[l + j * ldb];
+            for (int64_t i = 0; i < m; ++i) {
+                templ = temp;
+                templ *= A[i + l * lda];
+                C[i + j * ldc] += templ;
+            }
+        }
+    }
+}
+
+template <class T> std::vector<T> to_tiered(const mpf_class *x, int64_t len) {
+    std::vector<T> result(len);
+    for (int64_t i = 0; i < len; ++i) {
+        result[i] = T(x[i]);
+    }
+    return result;
+}
+
+template <class T> void run_tiered(int64_t M, int64_t K, int64_t N, const mpf_class &alpha, const mpf_class *A, const mpf_class *B, const mpf_class &beta, mpf_class *C, int prec, double &convert_seconds, double &elapsed_seconds) {
+    auto convert_start = std::chrono::high_resolution_clock::now();
+    std::vector<T> At = to_tiered<T>(A, M * K);
+    std::vector<T> Bt = to_tiered<T>(B, K * N);
+    std::vector<T> Ct = to_tiered<T>(C, M * N);
+    const T alpha_t(alpha);
+    const T beta_t(beta);
+    auto convert_end = std::chrono::high_resolution_clock::now();
+
+    auto start = std::chrono::high_resolution_clock::now();
+    _Rgemm(M, K, N, alpha_t, At.data(), M, Bt.data(), K, beta_t, Ct.data(), M);
+    auto end = std::chrono::high_resolution_clock::now();
+
+    for (int64_t i = 0; i < M * N; ++i) {
+        C[i] = Ct[i].to_mpf(prec);
+    }
+    convert_seconds = std::chrono::duration<double>(convert_end - convert_start).count();
+    elapsed_seconds = std::chrono::duration<double>(end - start).count();
+}
+
+int main(int argc, char **argv) {
+    // Initialize random state
+    gmp_randclass r(gmp_randinit_default);
+    r.seed(42);
+
+    // Check command-line arguments
+    if (argc != 5) {
+        std::cerr << "Usage: " << argv[0] << " <rows m> <cols k> <cols n> <precision>" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    int64_t M = std::atoll(argv[1]); // Number of rows in A and C
+    int64_t K = std::atoll(argv[2]); // Number of columns in A and rows in B
+    int64_t N = std::atoll(argv[3]); // Number of columns in B and C
+    int prec = std::atoi(argv[4]);   // Precision in bits
+    mpf_set_default_prec(prec);
+    gmpxx::gmpxx_defaults::set_initial_default_prec(prec);
+
+    // Allocate memory for A (M x K), B (K x N), C (M x N), and reference C (C_ref)
+    mpf_class *A = new mpf_class[M * K];
+    mpf_class *B = new mpf_class[K * N];
+    mpf_class *C = new mpf_class[M * N];
+    mpf_class *C_ref = new mpf_class[M * N];
+
+    // Initialize scalars alpha and beta with random values
+    mpf_class alpha = r.get_f(prec);
+    mpf_class beta = r.get_f(prec);
+
+    // Initialize matrix A with random values
+    for (int64_t i = 0; i < M; ++i) {
+        for (int64_t j = 0; j < K; ++j) {
+            A[i + j * M] = r.get_f(prec); // Column-major order
+        }
+    }
+
+    // Initialize matrix B with random values
+    for (int64_t i = 0; i < K; ++i) {
+        for (int64_t j = 0; j < N; ++j) {
+            B[i + j * K] = r.get_f(prec); // Column-major order
+        }
+    }
+
+    // Initialize matrix C with random values and copy to C_ref for reference
+    for (int64_t i = 0; i < M; ++i) {
+        for (int64_t j = 0; j < N; ++j) {
+            C[i + j * M] = r.get_f(prec);    // Column-major order
+            C_ref[i + j * M] = C[i + j * M]; // Copy for reference
+        }
+    }
+
+    // Perform _Rgemm on the cheapest representation for prec
+    double convert_seconds = 0.0;
+    double elapsed_seconds = 0.0;
+    if (prec <= (int)gmpxx::dd_real::digits) {
+        std::cout << "Engine: double-double" << std::endl;
+        run_tiered<gmpxx::dd_real>(M, K, N, alpha, A, B, beta, C, prec, convert_seconds, elapsed_seconds);
+    } else if (prec <= (int)gmpxx::qd_real::digits) {
+        std::cout << "Engine: quad-double" << std::endl;
+        run_tiered<gmpxx::qd_real>(M, K, N, alpha, A, B, beta, C, prec, convert_seconds, elapsed_seconds);
+    } else {
+        std::cout << "Engine: mpf" << std::endl;
+        auto start = std::chrono::high_resolution_clock::now();
+        _Rgemm(M, K, N, alpha, A, M, B, K, beta, C, M);
+        auto end = std::chrono::high_resolution_clock::now();
+        elapsed_seconds = std::chrono::duration<double>(end - start).count();
+    }
+
+    // Perform reference computation using Rgemm
+    Rgemm("n", "n", M, N, K, alpha, A, M, B, K, beta, C_ref, M);
+
+    // For matrix-matrix multiply, number of floating-point operations is 2 * M * N * K
+    double mflops = flops_gemm(M, N, K) / (elapsed_seconds * MFLOPS);
+
+    // Output performance metrics
+    std::cout << "Conversion time: " << convert_seconds << " s" << std::endl;
+    std::cout << "Elapsed time: " << elapsed_seconds << " s" << std::endl;
+    std::cout << "MFLOPS: " << mflops << std::endl;
+
+    // Compute L1 norm of the difference between C and C_ref
+    mpf_class l1_norm = 0;
+    for (int64_t i = 0; i < M; ++i) {
+        for (int64_t j = 0; j < N; ++j) {
+            mpf_class diff = abs(C[i + j * M] - C_ref[i + j * M]);
+            l1_norm += diff;
+        }
+    }
+
+    // Output L1 norm
+    std::cout << "L1 Norm of difference: ";
+    gmp_printf("%.4Fg\n", l1_norm.get_mpf_t());
+
+    // Verify correctness
+    mpf_class threshold = 1e-5;
+    if (l1_norm < threshold) {
+        std::cout << "Result OK" << std::endl;
+    } else {
+        std::cout << "Result NG" << std::endl;
+    }
+
+    // Clean up
+    delete[] A;
+    delete[] B;
+    delete[] C;
+    delete[] C_ref;
+
+    return EXIT_SUCCESS;
+}
@@ -42,6 +42,11 @@ executables=(
     "Rgemm_gmp_kernel_03_orig"
     "Rgemm_gmp_kernel_03_mkII"
     "Rgemm_gmp_kernel_03_mkII_NOPRECCHANGE"
+    "Rgemm_gmp_kernel_04_orig"
+    "Rgemm_gmp_kernel_04_mkII"
+    "Rgemm_gmp_kernel_04_mkII_NOPRECCHANGE"
+    "Rgemm_gmp_kernel_05_mkII"
+    "Rgemm_gmp_kernel_05_mkII_NOPRECCHANGE"
     "Rgemm_gmp_kernel_openmp_01_orig"
     "Rgemm_gmp_kernel_openmp_01_mkII"
     "Rgemm_gmp_kernel_openmp_01_mkII_NOPRECCHANGE"
@@ -51,6 +56,9 @@ executables=(
     "Rgemm_gmp_kernel_openmp_03_orig"
     "Rgemm_gmp_kernel_openmp_03_mkII"
     "Rgemm_gmp_kernel_openmp_03_mkII_NOPRECCHANGE"
+    "Rgemm_gmp_kernel_openmp_04_orig"
+    "Rgemm_gmp_kernel_openmp_04_mkII"
+    "Rgemm_gmp_kernel_openmp_04_mkII_NOPRECCHANGE"
 )
 for exe in "${executables[@]}"; do
     COMMAND_LINE="/usr/bin/time ./$exe 500 500 500 512"
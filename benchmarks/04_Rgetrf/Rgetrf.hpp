@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2026
+ *      Nakata, Maho
+ *      All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ */
+
+#pragma once
+
+// Right-looking blocked LU factorization with partial pivoting, and the
+// solve that uses it, on column-major mpf_class arrays.
+//
+// Rgetrf factors one panel of Rgetrf_block_size columns at a time with the
+// unblocked Rgetf2, applies the row interchanges to the rest of the matrix,
+// solves for the block row of U, and updates the trailing matrix with
+// C := C - A * B.  Almost all of the work ends up in that update.  The
+// triangular solves are Rtrsm, and the update is Rgemm_packed, both from
+// ../07_Rtrsm.  Pivot indices are 0-based: row k was interchanged with row
+// ipiv[k].
+
+#include <algorithm>
+#include <cstdint>
+
+#include "../07_Rtrsm/Rtrsm.hpp"
+
+inline constexpr int64_t Rgetrf_block_size = 32;
+
+// Applies the interchanges ipiv[k1..k2) to the n columns of A.
+inline void Rlaswp(int64_t n, mpf_class *A, int64_t lda, int64_t k1, int64_t k2, const int64_t *ipiv) {
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(static)
+#endif
+    for (int64_t j = 0; j < n; ++j) {
+        for (int64_t k = k1; k < k2; ++k) {
+            if (ipiv[k] != k) {
+                A[k + j * lda].swap(A[ipiv[k] + j * lda]);
+            }
+        }
+    }
+}
+
+// Unblocked LU of the m x n matrix A.  Returns 0, or k + 1 when U(k, k) is
+// exactly zero; the factorization is still completed in that case.
+inline int64_t Rgetf2(int64_t m, int64_t n, mpf_class *A, int64_t lda, int64_t *ipiv) {
+    int64_t info = 0;
+    const int64_t mn = std::min(m, n);
+    mpf_class pivot_abs, value_abs, recip;
+    for (int64_t j = 0; j < mn; ++j) {
+        int64_t p = j;
+        pivot_abs = abs(A[j + j * lda]);
+        for (int64_t i = j + 1; i < m; ++i) {
+            value_abs = abs(A[i + j * lda]);
+            if (value_abs > pivot_abs) {
+                pivot_abs = value_abs;
+                p = i;
+            }
+        }
+        ipiv[j] = p;
+        if (A[p + j * lda] == 0) {
+            if (info == 0) {
+                info = j + 1;
+            }
+            continue;
+        }
+        if (p != j) {
+            for (int64_t jj = 0; jj < n; ++jj) {
+                A[j + jj * lda].swap(A[p + jj * lda]);
+            }
+        }
+        recip = 1;
+        recip /= A[j + j * lda];
+#if defined(_OPENMP)
+#pragma omp parallel
+#endif
+        {
+            mpf_class temp;
+#if defined(_OPENMP)
+#pragma omp for schedule(static)
+#endif
+            for (int64_t i = j + 1; i < m; ++i) {
+                A[i + j * lda] *= recip;
+                for (int64_t jj = j + 1; jj < n; ++jj) {
+                    temp = A[i + j * lda];
+                    temp *= A[j + jj * lda];
+                    A[i + jj * lda] -= temp;
+                }
+            }
+        }
+    }
+    return info;
+}
+
+// Blocked LU of the m x n matrix A, with the same result convention as
+// Rgetf2.
+inline int64_t Rgetrf(int64_t m, int64_t n, mpf_class *A, int64_t lda, int64_t *ipiv, int64_t nb = Rgetrf_block_size) {
+    const int64_t mn = std::min(m, n);
+    if (nb <= 1 || nb >= mn) {
+        return Rgetf2(m, n, A, lda, ipiv);
+    }
+    const mpf_class one = 1, minus_one = -1;
+    int64_t info = 0;
+    for (int64_t j = 0; j < mn; j += nb) {
+        const int64_t jb = std::min(nb, mn - j);
+        const int64_t panel_info = Rgetf2(m - j, jb, &A[j + j * lda], lda, &ipiv[j]);
+        if (info == 0 && panel_info > 0) {
+            info = panel_info + j;
+        }
+        for (int64_t i = j; i < j + jb; ++i) {
+            ipiv[i] += j;
+        }
+        Rlaswp(j, A, lda, j, j + jb, ipiv);
+        const int64_t rest = n - j - jb;
+        if (rest > 0) {
+            Rlaswp(rest, &A[(j + jb) * lda], lda, j, j + jb, ipiv);
+            Rtrsm('L', 'L', 'N', 'U', jb, rest, one, &A[j + j * lda], lda, &A[j + (j + jb) * lda], lda);
+            Rgemm_packed(false, false, m - j - jb, rest, jb, minus_one, &A[(j + jb) + j * lda], lda, &A[j + (j + jb) * lda], lda, &A[(j + jb) + (j + jb) * lda], lda);
+        }
+    }
+    return info;
+}
+
+// Solves A * X = B with the factors from Rgetrf; B is n x nrhs.
+inline void Rgetrs(int64_t n, int64_t nrhs, const mpf_class *A, int64_t lda, const int64_t *ipiv, mpf_class *B, int64_t ldb) {
+    const mpf_class one = 1;
+    Rlaswp(nrhs, B, ldb, 0, n, ipiv);
+    Rtrsm('L', 'L', 'N', 'U', n, nrhs, one, A, lda, B, ldb);
+    Rtrsm('L', 'U', 'N', 'N', n, nrhs, one, A, lda, B, ldb);
+}
+
+// cf. https://netlib.org/lapack/lawnspdf/lawn41.pdf p.121, m >= n
+inline double flops_getrf(int64_t m_i, int64_t n_i) {
+    double m = (double)m_i;
+    double n = (double)n_i;
+    double muls = 0.5 * m * n * n - n * n * n / 6.0 + 0.5 * m * n - 0.5 * n * n + 2.0 * n / 3.0;
+    double adds = 0.5 * m * n * n - n * n * n / 6.0 - 0.5 * m * n + n / 6.0;
+    return muls + adds;
+}
+
+// L1 norm of b - A * x for an n x n matrix A.
+inline mpf_class Rgetrf_residual(int64_t n, const mpf_class *A, int64_t lda, const mpf_class *x, const mpf_class *b) {
+    mpf_class norm = 0;
+    mpf_class r, temp;
+    for (int64_t i = 0; i < n; ++i) {
+        r = b[i];
+        for (int64_t j = 0; j < n; ++j) {
+            temp = A[i + j * lda];
+            temp *= x[j];
+            r -= temp;
+        }
+        norm += abs(r);
+    }
+    return norm;
+}
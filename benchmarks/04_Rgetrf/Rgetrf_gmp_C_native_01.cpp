@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2026
+ *      Nakata, Maho
+ *      All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ */
+
+#include <iostream>
+#include <chrono>
+#include <cstdlib>
+#include <vector>
+#include <gmp.h>
+
+#if defined USE_ORIGINAL_GMPXX
+#include <gmpxx.h>
+#else
+#include "gmpxx_mkII.h"
+#if !defined ___GMPXX_STRICT_COMPATIBILITY___
+using namespace gmpxx;
+#endif
+#endif
+
+#include "Rgetrf.hpp"
+
+#define MFLOPS 1e+6
+
+gmp_randstate_t state;
+
+// Unblocked right-looking LU with partial pivoting on mpf_t
+int64_t _Rgetrf(int64_t n, mpf_t *A, int64_t lda, int64_t *ipiv, int prec) {
+    int64_t info = 0;
+    mpf_t pivot_abs, value_abs, recip, temp;
+    mpf_init2(pivot_abs, prec);
+    mpf_init2(value_abs, prec);
+    mpf_init2(recip, prec);
+    mpf_init2(temp, prec);
+    for (int64_t j = 0; j < n; ++j) {
+        int64_t p = j;
+        mpf_abs(pivot_abs, A[j + j * lda]);
+        for (int64_t i = j + 1; i < n; ++i) {
+            mpf_abs(value_abs, A[i + j * lda]);
+            if (mpf_cmp(value_abs, pivot_abs) > 0) {
+                mpf_set(pivot_abs, value_abs);
+                p = i;
+            }
+        }
+        ipiv[j] = p;
+        if (mpf_sgn(A[p + j * lda]) == 0) {
+            if (info == 0) {
+                info = j + 1;
+            }
+            continue;
+        }
+        if (p != j) {
+            for (int64_t jj = 0; jj < n; ++jj) {
+                mpf_swap(A[j + jj * lda], A[p + jj * lda]);
+            }
+        }
+        mpf_ui_div(recip, 1, A[j + j * lda]);
+        for (int64_t i = j + 1; i < n; ++i) {
+            mpf_mul(A[i + j * lda], A[i + j * lda], recip);
+            for (int64_t jj = j + 1; jj < n; ++jj) {
+                mpf_mul(temp, A[i + j * lda], A[j + jj * lda]);
+                mpf_sub(A[i + jj * lda], A[i + jj * lda], temp);
+            }
+        }
+    }
+    mpf_clear(pivot_abs);
+    mpf_clear(value_abs);
+    mpf_clear(recip);
+    mpf_clear(temp);
+    return info;
+}
+
+int main(int argc, char **argv) {
+    gmp_randinit_default(state);
+    gmp_randseed_ui(state, 42);
+
+    if (argc != 3) {
+        std::cerr << "Usage: " << argv[0] << " <matrix size n> <precision>" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    int64_t n = std::atoll(argv[1]);
+    int prec = std::atoi(argv[2]);
+    mpf_set_default_prec(prec);
+#if !defined USE_ORIGINAL_GMPXX
+    gmpxx::gmpxx_defaults::set_initial_default_prec(prec);
+#endif
+
+    int64_t lda = n; // Leading dimension for A
+    mpf_t *LU = new mpf_t[n * n];
+    std::vector<int64_t> ipiv(n);
+    for (int64_t j = 0; j < n; ++j) {
+        for (int64_t i = 0; i < n; ++i) {
+            mpf_init2(LU[i + j * lda], prec);
+            mpf_urandomb(LU[i + j * lda], state, prec); // 0 <= LU[i + j*lda] < 1
+        }
+    }
+
+    // Keep A and b as mpf_class for the solve and the residual
+    mpf_class *A = new mpf_class[n * n];
+    mpf_class *b = new mpf_class[n];
+    mpf_class *x = new mpf_class[n];
+    for (int64_t j = 0; j < n; ++j) {
+        for (int64_t i = 0; i < n; ++i) {
+            A[i + j * lda] = mpf_class(LU[i + j * lda]);
+        }
+    }
+    mpf_t value;
+    mpf_init2(value, prec);
+    for (int64_t i = 0; i < n; ++i) {
+        mpf_urandomb(value, state, prec);
+        b[i] = mpf_class(value);
+        x[i] = b[i];
+    }
+    mpf_clear(value);
+
+    // Perform _Rgetrf
+    auto start = std::chrono::high_resolution_clock::now();
+    int64_t info = _Rgetrf(n, LU, lda, ipiv.data(), prec);
+    auto end = std::chrono::high_resolution_clock::now();
+
+    // Solve A x = b with the factors
+    mpf_class *LU_mpf_class = new mpf_class[n * n];
+    for (int64_t j = 0; j < n; ++j) {
+        for (int64_t i = 0; i < n; ++i) {
+            LU_mpf_class[i + j * lda] = mpf_class(LU[i + j * lda]);
+        }
+    }
+    Rgetrs(n, 1, LU_mpf_class, lda, ipiv.data(), x, n);
+
+    std::chrono::duration<double> elapsed_seconds = end - start;
+    double mflops = flops_getrf(n, n) / (elapsed_seconds.count() * MFLOPS);
+
+    std::cout << "Elapsed time: " << elapsed_seconds.count() << " s" << std::endl;
+    std::cout << "MFLOPS: " << mflops << std::endl;
+
+    mpf_class l1_norm = Rgetrf_residual(n, A, lda, x, b);
+    std::cout << "L1 Norm of residual: ";
+    gmp_printf("%.4Fe\n", l1_norm.get_mpf_t());
+
+    mpf_class threshold = 1e-5;
+    if (info == 0 && l1_norm < threshold) {
+        std::cout << "Result OK" << std::endl;
+    } else {
+        std::cout << "Result NG" << std::endl;
+    }
+
+    // Clear memory
+    for (int64_t j = 0; j < n; ++j) {
+        for (int64_t i = 0; i < n; ++i) {
+            mpf_clear(LU[i + j * lda]);
+        }
+    }
+    delete[] LU;
+    delete[] LU_mpf_class;
+    delete[] A;
+    delete[] b;
+    delete[] x;
+
+    gmp_randclear(state);
+
+    return EXIT_SUCCESS;
+}
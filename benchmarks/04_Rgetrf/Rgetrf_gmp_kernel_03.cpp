@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2026
+ *      Nakata, Maho
+ *      All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ */
+
+// Mixed-precision iterative refinement through gmpxx::solve_refined.  This
+// file needs gmpxx_mkII and is not built against the original gmpxx.
+
+#include <iostream>
+#include <chrono>
+#include <cstdlib>
+#include <vector>
+
+#include "gmpxx_mkII.h"
+#if !defined ___GMPXX_STRICT_COMPATIBILITY___
+using namespace gmpxx;
+#endif
+
+#include "Rgetrf.hpp"
+
+#define MFLOPS 1e+6
+
+// LU in double, then refinement steps with residuals at the target
+// precision until x is accurate to prec bits.
+std::vector<mpf_class> _Rgesv_refined(const std::vector<mpf_class> &A, const std::vector<mpf_class> &b, int prec, gmpxx::refinement_info &info) {
+    return gmpxx::solve_refined(A, b, prec, &info);
+}
+
+int main(int argc, char **argv) {
+    // Initialize random state
+    gmp_randclass r(gmp_randinit_default);
+    r.seed(42);
+
+    // Check command-line arguments
+    if (argc != 3) {
+        std::cerr << "Usage: " << argv[0] << " <matrix size n> <precision>" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    int64_t N = std::atoll(argv[1]); // Order of A
+    int prec = std::atoi(argv[2]);   // Precision in bits
+    mpf_set_default_prec(prec);
+    gmpxx::gmpxx_defaults::set_initial_default_prec(prec);
+
+    // A (N x N) and b are kept for the residual
+    std::vector<mpf_class> A(N * N);
+    std::vector<mpf_class> b(N);
+
+    for (int64_t j = 0; j < N; ++j) {
+        for (int64_t i = 0; i < N; ++i) {
+            A[i + j * N] = r.get_f(prec); // Column-major order
+        }
+    }
+    for (int64_t i = 0; i < N; ++i) {
+        b[i] = r.get_f(prec);
+    }
+
+    // Perform _Rgesv_refined; the time covers the factorization and all
+    // refinement steps
+    gmpxx::refinement_info refinement;
+    auto start = std::chrono::high_resolution_clock::now();
+    std::vector<mpf_class> x = _Rgesv_refined(A, b, prec, refinement);
+    auto end = std::chrono::high_resolution_clock::now();
+
+    // MFLOPS counts the flops of a direct factorization at this precision
+    std::chrono::duration<double> elapsed = end - start;
+    double mflops = flops_getrf(N, N) / (elapsed.count() * MFLOPS);
+
+    // Output performance metrics
+    std::cout << "Elapsed time: " << elapsed.count() << " s" << std::endl;
+    std::cout << "MFLOPS: " << mflops << std::endl;
+    std::cout << "Refinement steps: " << refinement.iterations << std::endl;
+    std::cout << "Factor precision: " << refinement.factor_prec << std::endl;
+
+    // L1 norm of the residual b - A x
+    mpf_class l1_norm = Rgetrf_residual(N, A.data(), N, x.data(), b.data());
+    std::cout << "L1 Norm of residual: ";
+    gmp_printf("%.4Fg\n", l1_norm.get_mpf_t());
+
+    // Verify correctness
+    mpf_class threshold = 1e-5;
+    if (l1_norm < threshold) {
+        std::cout << "Result OK" << std::endl;
+    } else {
+        std::cout << "Result NG" << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2026
+ *      Nakata, Maho
+ *      All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ */
+
+#include <iostream>
+#include <chrono>
+#include <cstdlib>
+#include <vector>
+
+#if defined USE_ORIGINAL_GMPXX
+#include <gmpxx.h>
+#else
+#include "gmpxx_mkII.h"
+#if !defined ___GMPXX_STRICT_COMPATIBILITY___
+using namespace gmpxx;
+#endif
+#endif
+
+#include "Rgetrf.hpp"
+
+#define MFLOPS 1e+6
+
+#include <omp.h>
+
+// Blocked right-looking LU with the panel, interchanges, triangular solve,
+// and trailing update parallelized over rows or columns.
+int64_t _Rgetrf(int64_t n, mpf_class *A, int64_t lda, int64_t *ipiv) {
+    return Rgetrf(n, n, A, lda, ipiv);
+}
+
+int main(int argc, char **argv) {
+    // Initialize random state
+    gmp_randclass r(gmp_randinit_default);
+    r.seed(42);
+
+    // Check command-line arguments
+    if (argc != 3) {
+        std::cerr << "Usage: " << argv[0] << " <matrix size n> <precision>" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    int64_t N = std::atoll(argv[1]); // Order of A
+    int prec = std::atoi(argv[2]);   // Precision in bits
+    mpf_set_default_prec(prec);
+#if !defined USE_ORIGINAL_GMPXX
+    gmpxx::gmpxx_defaults::set_initial_default_prec(prec);
+#endif
+
+    // A (N x N) is kept for the residual; LU is factored in place
+    mpf_class *A = new mpf_class[N * N];
+    mpf_class *LU = new mpf_class[N * N];
+    mpf_class *b = new mpf_class[N];
+    mpf_class *x = new mpf_class[N];
+    std::vector<int64_t> ipiv(N);
+
+    for (int64_t j = 0; j < N; ++j) {
+        for (int64_t i = 0; i < N; ++i) {
+            A[i + j * N] = r.get_f(prec); // Column-major order
+            LU[i + j * N] = A[i + j * N];
+        }
+    }
+    for (int64_t i = 0; i < N; ++i) {
+        b[i] = r.get_f(prec);
+        x[i] = b[i];
+    }
+
+    // Perform _Rgetrf
+    auto start = std::chrono::high_resolution_clock::now();
+    int64_t info = _Rgetrf(N, LU, N, ipiv.data());
+    auto end = std::chrono::high_resolution_clock::now();
+
+    // Solve A x = b with the factors
+    auto solve_start = std::chrono::high_resolution_clock::now();
+    Rgetrs(N, 1, LU, N, ipiv.data(), x, N);
+    auto solve_end = std::chrono::high_resolution_clock::now();
+
+    std::chrono::duration<double> elapsed = end - start;
+    std::chrono::duration<double> solve_elapsed = solve_end - solve_start;
+    double mflops = flops_getrf(N, N) / (elapsed.count() * MFLOPS);
+
+    // Output performance metrics
+    std::cout << "Elapsed time: " << elapsed.count() << " s" << std::endl;
+    std::cout << "Solve time: " << solve_elapsed.count() << " s" << std::endl;
+    std::cout << "MFLOPS: " << mflops << std::endl;
+
+    // L1 norm of the residual b - A x
+    mpf_class l1_norm = Rgetrf_residual(N, A, N, x, b);
+    std::cout << "L1 Norm of residual: ";
+    gmp_printf("%.4Fg\n", l1_norm.get_mpf_t());
+
+    // Verify correctness
+    mpf_class threshold = 1e-5;
+    if (info == 0 && l1_norm < threshold) {
+        std::cout << "Result OK" << std::endl;
+    } else {
+        std::cout << "Result NG" << std::endl;
+    }
+
+    // Clean up
+    delete[] A;
+    delete[] LU;
+    delete[] b;
+    delete[] x;
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2026
+ *      Nakata, Maho
+ *      All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ */
+
+#pragma once
+
+// Right-looking blocked Cholesky factorization A = L * L^T of a symmetric
+// positive-definite matrix held in the lower triangle of a column-major
+// mpf_class array, and the matching solve.
+//
+// Rpotrf factors one diagonal block of Rpotrf_block_size columns with the
+// unblocked Rpotf2, solves for the panel below it, and subtracts the
+// panel's outer product from the trailing matrix.  The solve and the update
+// are Rtrsm and Rsyrk from ../07_Rtrsm, which run on the packed tile engine.
+// The strict upper triangle of A is not referenced.
+
+#include <algorithm>
+#include <cstdint>
+
+#include "../07_Rtrsm/Rsyrk.hpp"
+#include "../07_Rtrsm/Rtrsm.hpp"
+
+inline constexpr int64_t Rpotrf_block_size = 32;
+
+// Unblocked Cholesky of the n x n matrix A.  Returns 0, or j + 1 when the
+// leading minor of order j + 1 is not positive definite.
+inline int64_t Rpotf2(int64_t n, mpf_class *A, int64_t lda) {
+    mpf_class recip;
+    for (int64_t j = 0; j < n; ++j) {
+        if (A[j + j * lda] <= 0) {
+            return j + 1;
+        }
+        A[j + j * lda] = sqrt(A[j + j * lda]);
+        recip = 1;
+        recip /= A[j + j * lda];
+        for (int64_t i = j + 1; i < n; ++i) {
+            A[i + j * lda] *= recip;
+        }
+#if defined(_OPENMP)
+#pragma omp parallel
+#endif
+        {
+            mpf_class temp;
+#if defined(_OPENMP)
+#pragma omp for schedule(dynamic)
+#endif
+            for (int64_t jj = j + 1; jj < n; ++jj) {
+                for (int64_t i = jj; i < n; ++i) {
+                    temp = A[jj + j * lda];
+                    temp *= A[i + j * lda];
+                    A[i + jj * lda] -= temp;
+                }
+            }
+        }
+    }
+    return 0;
+}
+
+// Blocked Cholesky of the n x n matrix A, with the same result convention as
+// Rpotf2.
+inline int64_t Rpotrf(int64_t n, mpf_class *A, int64_t lda, int64_t nb = Rpotrf_block_size) {
+    if (nb <= 1 || nb >= n) {
+        return Rpotf2(n, A, lda);
+    }
+    const mpf_class one = 1, minus_one = -1;
+    for (int64_t j = 0; j < n; j += nb) {
+        const int64_t jb = std::min(nb, n - j);
+        const int64_t info = Rpotf2(jb, &A[j + j * lda], lda);
+        if (info != 0) {
+            return info + j;
+        }
+        const int64_t rest = n - j - jb;
+        if (rest > 0) {
+            Rtrsm('R', 'L', 'T', 'N', rest, jb, one, &A[j + j * lda], lda, &A[(j + jb) + j * lda], lda);
+            Rsyrk('L', 'N', rest, jb, minus_one, &A[(j + jb) + j * lda], lda, one, &A[(j + jb) + (j + jb) * lda], lda);
+        }
+    }
+    return 0;
+}
+
+// Solves A * X = B with the factor from Rpotrf; B is n x nrhs.
+inline void Rpotrs(int64_t n, int64_t nrhs, const mpf_class *A, int64_t lda, mpf_class *B, int64_t ldb) {
+#if defined(_OPENMP)
+#pragma omp parallel
+#endif
+    {
+        mpf_class temp;
+#if defined(_OPENMP)
+#pragma omp for schedule(static)
+#endif
+        for (int64_t j = 0; j < nrhs; ++j) {
+            mpf_class *b = &B[j * ldb];
+            for (int64_t k = 0; k < n; ++k) {
+                b[k] /= A[k + k * lda];
+                for (int64_t i = k + 1; i < n; ++i) {
+                    temp = b[k];
+                    temp *= A[i + k * lda];
+                    b[i] -= temp;
+                }
+            }
+            for (int64_t k = n - 1; k >= 0; --k) {
+                for (int64_t i = k + 1; i < n; ++i) {
+                    temp = b[i];
+                    temp *= A[i + k * lda];
+                    b[k] -= temp;
+                }
+                b[k] /= A[k + k * lda];
+            }
+        }
+    }
+}
+
+// cf. https://netlib.org/lapack/lawnspdf/lawn41.pdf p.121
+inline double flops_potrf(int64_t n_i) {
+    double n = (double)n_i;
+    double muls = n * n * n / 6.0 + n * n / 2.0 + n / 3.0;
+    double adds = n * n * n / 6.0 - n / 6.0;
+    return muls + adds;
+}
+
+// L1 norm of b - A * x for a full n x n matrix A.
+inline mpf_class Rsymmetric_residual(int64_t n, const mpf_class *A, int64_t lda, const mpf_class *x, const mpf_class *b) {
+    mpf_class norm = 0;
+    mpf_class r, temp;
+    for (int64_t i = 0; i < n; ++i) {
+        r = b[i];
+        for (int64_t j = 0; j < n; ++j) {
+            temp = A[i + j * lda];
+            temp *= x[j];
+            r -= temp;
+        }
+        norm += abs(r);
+    }
+    return norm;
+}
@@ -0,0 +1,444 @@
+/*
+ * Copyright (c) 2026
+ *      Nakata, Maho
+ *      All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ */
+
+#pragma once
+
+// Blocked LDL^T factorization with Bunch-Kaufman diagonal pivoting,
+// P * A * P^T = L * D * L^T, for a symmetric matrix held in the lower
+// triangle of a column-major mpf_class array, and the matching solve.
+//
+// D is block diagonal with 1 x 1 and 2 x 2 blocks.  On exit the lower
+// triangle of A holds D and the unit lower triangular L; for a 2 x 2 block
+// starting at k, A(k + 1, k) is the off-diagonal entry of D and L(k + 1, k)
+// is zero.  Unlike LAPACK, the interchanges are applied to the whole rows of
+// L, so P is simply the product of the interchanges in order.  ipiv uses the
+// LAPACK encoding, 0-based: ipiv[k] = p >= 0 means a 1 x 1 block at k after
+// interchanging rows k and p; ipiv[k] = ipiv[k + 1] = -(p + 1) means a
+// 2 x 2 block at k after interchanging rows k + 1 and p.
+//
+// Rsytrf factors panels of Rsytrf_block_size columns with Rlasyf.  Rlasyf
+// keeps W = L * D for the panel, so a candidate pivot column can be brought
+// up to date without touching the trailing matrix.  The trailing matrix is
+// then updated once, with A22 := A22 - L21 * W21^T, by Rgemmt from
+// ../07_Rtrsm/Rsyrk.hpp, since the product is symmetric.
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "Rpotrf.hpp"
+
+inline constexpr int64_t Rsytrf_block_size = 32;
+
+// (1 + sqrt(17)) / 8, the Bunch-Kaufman growth bound.
+inline const mpf_class &Rsytrf_alpha() {
+    static const mpf_class alpha = (1 + sqrt(mpf_class(17))) / 8;
+    return alpha;
+}
+
+// Interchanges rows and columns kk < kp of the symmetric trailing matrix
+// A(kk:n, kk:n) held in the lower triangle, and rows kk and kp of the first
+// kk columns.
+inline void Rsytrf_swap(int64_t n, mpf_class *A, int64_t lda, int64_t kk, int64_t kp) {
+    for (int64_t i = kp + 1; i < n; ++i) {
+        A[i + kk * lda].swap(A[i + kp * lda]);
+    }
+    for (int64_t j = kk + 1; j < kp; ++j) {
+        A[j + kk * lda].swap(A[kp + j * lda]);
+    }
+    A[kk + kk * lda].swap(A[kp + kp * lda]);
+    for (int64_t j = 0; j < kk; ++j) {
+        A[kk + j * lda].swap(A[kp + j * lda]);
+    }
+}
+
+// Unblocked LDL^T of columns k0..n-1 of the n x n matrix A; columns before
+// k0 are already factored.  Returns 0, or k + 1 when D(k, k) is exactly
+// zero.
+inline int64_t Rsytf2(int64_t n, mpf_class *A, int64_t lda, int64_t *ipiv, int64_t k0 = 0) {
+    const mpf_class &alpha = Rsytrf_alpha();
+    int64_t info = 0;
+    mpf_class absakk, colmax, rowmax, value_abs, r1, d11, d22, d21, t;
+    int64_t k = k0;
+    while (k < n) {
+        int64_t kstep = 1;
+        int64_t kp = k;
+        absakk = abs(A[k + k * lda]);
+        int64_t imax = k;
+        colmax = 0;
+        for (int64_t i = k + 1; i < n; ++i) {
+            value_abs = abs(A[i + k * lda]);
+            if (value_abs > colmax) {
+                colmax = value_abs;
+                imax = i;
+            }
+        }
+        if (absakk == 0 && colmax == 0) {
+            if (info == 0) {
+                info = k + 1;
+            }
+            ipiv[k] = k;
+            ++k;
+            continue;
+        }
+        if (absakk < alpha * colmax) {
+            rowmax = 0;
+            for (int64_t j = k; j < imax; ++j) {
+                value_abs = abs(A[imax + j * lda]);
+                if (value_abs > rowmax) {
+                    rowmax = value_abs;
+                }
+            }
+            for (int64_t i = imax + 1; i < n; ++i) {
+                value_abs = abs(A[i + imax * lda]);
+                if (value_abs > rowmax) {
+                    rowmax = value_abs;
+                }
+            }
+            if (absakk * rowmax >= alpha * colmax * colmax) {
+                kp = k;
+            } else if (abs(A[imax + imax * lda]) >= alpha * rowmax) {
+                kp = imax;
+            } else {
+                kp = imax;
+                kstep = 2;
+            }
+        }
+        const int64_t kk = k + kstep - 1;
+        if (kp != kk) {
+            Rsytrf_swap(n, A, lda, kk, kp);
+        }
+        if (kstep == 1) {
+            // A22 := A22 - x * x^T / d, then x := x / d.
+            r1 = 1;
+            r1 /= A[k + k * lda];
+#if defined(_OPENMP)
+#pragma omp parallel
+#endif
+            {
+                mpf_class temp;
+#if defined(_OPENMP)
+#pragma omp for schedule(dynamic)
+#endif
+                for (int64_t j = k + 1; j < n; ++j) {
+                    mpf_class lj = A[j + k * lda] * r1;
+                    for (int64_t i = j; i < n; ++i) {
+                        temp = lj;
+                        temp *= A[i + k * lda];
+                        A[i + j * lda] -= temp;
+                    }
+                }
+            }
+            for (int64_t i = k + 1; i < n; ++i) {
+                A[i + k * lda] *= r1;
+            }
+            ipiv[k] = kp;
+        } else if (k + 2 < n) {
+            // [wk wkp1] = [A(:, k) A(:, k + 1)] * inv(D), computed with the
+            // scaling that LAPACK's dsytf2 uses to avoid cancellation.
+            d21 = A[(k + 1) + k * lda];
+            d11 = A[(k + 1) + (k + 1) * lda] / d21;
+            d22 = A[k + k * lda] / d21;
+            t = 1 / (d11 * d22 - 1);
+            d21 = t / d21;
+            std::vector<mpf_class> wk(n - k - 2), wkp1(n - k - 2);
+            for (int64_t j = k + 2; j < n; ++j) {
+                wk[j - k - 2] = d21 * (d11 * A[j + k * lda] - A[j + (k + 1) * lda]);
+                wkp1[j - k - 2] = d21 * (d22 * A[j + (k + 1) * lda] - A[j + k * lda]);
+            }
+#if defined(_OPENMP)
+#pragma omp parallel
+#endif
+            {
+                mpf_class temp;
+#if defined(_OPENMP)
+#pragma omp for schedule(dynamic)
+#endif
+                for (int64_t j = k + 2; j < n; ++j) {
+                    for (int64_t i = j; i < n; ++i) {
+                        temp = A[i + k * lda] * wk[j - k - 2];
+                        temp += A[i + (k + 1) * lda] * wkp1[j - k - 2];
+                        A[i + j * lda] -= temp;
+                    }
+                }
+            }
+            for (int64_t j = k + 2; j < n; ++j) {
+                A[j + k * lda] = wk[j - k - 2];
+                A[j + (k + 1) * lda] = wkp1[j - k - 2];
+            }
+        }
+        if (kstep == 2) {
+            ipiv[k] = ipiv[k + 1] = -(kp + 1);
+        }
+        k += kstep;
+    }
+    return info;
+}
+
+// Factors at most nb - 1 or nb columns starting at k0, leaving the trailing
+// matrix A(k0 + kb:n, k0 + kb:n) updated.  Returns the number of columns kb
+// factored; info is set as in Rsytf2.  W must hold n rows and nb columns.
+inline int64_t Rlasyf(int64_t n, mpf_class *A, int64_t lda, int64_t *ipiv, int64_t k0, int64_t nb, mpf_class *W, int64_t ldw, int64_t &info) {
+    const mpf_class &alpha = Rsytrf_alpha();
+    mpf_class absakk, colmax, rowmax, value_abs, d11, d22, d21, t, temp;
+    int64_t k = k0;
+    // W(i, j) with j relative to the panel
+    auto w = [&](int64_t i, int64_t j) -> mpf_class & { return W[i + j * ldw]; };
+    // W(k:n, j) := W(k:n, j) - A(k:n, k0:k) * W(r, 0:j)^T
+    auto update_column = [&](int64_t j, int64_t r) {
+#if defined(_OPENMP)
+#pragma omp parallel for private(temp) schedule(static)
+#endif
+        for (int64_t i = k; i < n; ++i) {
+            for (int64_t c = 0; c < k - k0; ++c) {
+                temp = A[i + (k0 + c) * lda];
+                temp *= w(r, c);
+                w(i, j) -= temp;
+            }
+        }
+    };
+    while (k - k0 < nb - 1 && k < n) {
+        const int64_t j = k - k0;
+        int64_t kstep = 1;
+        int64_t kp = k;
+        for (int64_t i = k; i < n; ++i) {
+            w(i, j) = A[i + k * lda];
+        }
+        update_column(j, k);
+        absakk = abs(w(k, j));
+        int64_t imax = k;
+        colmax = 0;
+        for (int64_t i = k + 1; i < n; ++i) {
+            value_abs = abs(w(i, j));
+            if (value_abs > colmax) {
+                colmax = value_abs;
+                imax = i;
+            }
+        }
+        if (absakk == 0 && colmax == 0) {
+            if (info == 0) {
+                info = k + 1;
+            }
+            for (int64_t i = k; i < n; ++i) {
+                A[i + k * lda] = w(i, j);
+            }
+            ipiv[k] = k;
+            ++k;
+            continue;
+        }
+        if (absakk < alpha * colmax) {
+            // Bring column imax up to date in W(:, j + 1).
+            for (int64_t i = k; i < imax; ++i) {
+                w(i, j + 1) = A[imax + i * lda];
+            }
+            for (int64_t i = imax; i < n; ++i) {
+                w(i, j + 1) = A[i + imax * lda];
+            }
+            update_column(j + 1, imax);
+            rowmax = 0;
+            for (int64_t i = k; i < n; ++i) {
+                if (i == imax) {
+                    continue;
+                }
+                value_abs = abs(w(i, j + 1));
+                if (value_abs > rowmax) {
+                    rowmax = value_abs;
+                }
+            }
+            if (absakk * rowmax >= alpha * colmax * colmax) {
+                kp = k;
+            } else if (abs(w(imax, j + 1)) >= alpha * rowmax) {
+                kp = imax;
+                for (int64_t i = k; i < n; ++i) {
+                    w(i, j) = w(i, j + 1);
+                }
+            } else {
+                kp = imax;
+                kstep = 2;
+            }
+        }
+        const int64_t kk = k + kstep - 1;
+        if (kp != kk) {
+            // Column kk of A is superseded by W, so it is copied rather than
+            // swapped into column kp.
+            A[kp + kp * lda] = A[kk + kk * lda];
+            for (int64_t i = kk + 1; i < kp; ++i) {
+                A[kp + i * lda] = A[i + kk * lda];
+            }
+            for (int64_t i = kp + 1; i < n; ++i) {
+                A[i + kp * lda] = A[i + kk * lda];
+            }
+            for (int64_t c = 0; c < kk; ++c) {
+                A[kk + c * lda].swap(A[kp + c * lda]);
+            }
+            for (int64_t c = 0; c <= kk - k0; ++c) {
+                w(kk, c).swap(w(kp, c));
+            }
+        }
+        if (kstep == 1) {
+            A[k + k * lda] = w(k, j);
+            if (k + 1 < n) {
+                d11 = 1;
+                d11 /= w(k, j);
+                for (int64_t i = k + 1; i < n; ++i) {
+                    A[i + k * lda] = w(i, j) * d11;
+                }
+            }
+            ipiv[k] = kp;
+        } else {
+            d21 = w(k + 1, j);
+            d11 = w(k + 1, j + 1) / d21;
+            d22 = w(k, j) / d21;
+            t = 1 / (d11 * d22 - 1);
+            d21 = t / d21;
+            for (int64_t i = k + 2; i < n; ++i) {
+                A[i + k * lda] = d21 * (d11 * w(i, j) - w(i, j + 1));
+                A[i + (k + 1) * lda] = d21 * (d22 * w(i, j + 1) - w(i, j));
+            }
+            A[k + k * lda] = w(k, j);
+            A[(k + 1) + k * lda] = w(k + 1, j);
+            A[(k + 1) + (k + 1) * lda] = w(k + 1, j + 1);
+            ipiv[k] = ipiv[k + 1] = -(kp + 1);
+        }
+        k += kstep;
+    }
+    const int64_t kb = k - k0;
+    if (k < n) {
+        const mpf_class one = 1, minus_one = -1;
+        Rgemmt('L', 'N', 'T', n - k, kb, minus_one, &A[k + k0 * lda], lda, &W[k], ldw, one, &A[k + k * lda], lda);
+    }
+    return kb;
+}
+
+// Blocked LDL^T of the n x n matrix A, with the same result convention as
+// Rsytf2.
+inline int64_t Rsytrf(int64_t n, mpf_class *A, int64_t lda, int64_t *ipiv, int64_t nb = Rsytrf_block_size) {
+    if (nb <= 2 || nb >= n) {
+        return Rsytf2(n, A, lda, ipiv);
+    }
+    int64_t info = 0;
+    std::vector<mpf_class> W((size_t)(n * nb));
+    int64_t k = 0;
+    while (n - k > nb) {
+        k += Rlasyf(n, A, lda, ipiv, k, nb, W.data(), n, info);
+    }
+    const int64_t tail_info = Rsytf2(n, A, lda, ipiv, k);
+    if (info == 0) {
+        info = tail_info;
+    }
+    return info;
+}
+
+// Solves A * X = B with the factors from Rsytrf; B is n x nrhs.
+inline void Rsytrs(int64_t n, int64_t nrhs, const mpf_class *A, int64_t lda, const int64_t *ipiv, mpf_class *B, int64_t ldb) {
+    // block[k] is the order of the block of D starting at k, or 0 on the
+    // second row of a 2 x 2 block.
+    std::vector<int> block(n);
+    for (int64_t k = 0; k < n; ++k) {
+        if (ipiv[k] >= 0) {
+            block[k] = 1;
+        } else {
+            block[k] = 2;
+            block[++k] = 0;
+        }
+    }
+#if defined(_OPENMP)
+#pragma omp parallel
+#endif
+    {
+        mpf_class temp, akm1k, akm1, ak, denom, bkm1, bk;
+#if defined(_OPENMP)
+#pragma omp for schedule(static)
+#endif
+        for (int64_t j = 0; j < nrhs; ++j) {
+            mpf_class *b = &B[j * ldb];
+            // b := P * b
+            for (int64_t k = 0; k < n; ++k) {
+                if (block[k] == 1 && ipiv[k] != k) {
+                    b[k].swap(b[ipiv[k]]);
+                } else if (block[k] == 0 && -ipiv[k] - 1 != k) {
+                    b[k].swap(b[-ipiv[k] - 1]);
+                }
+            }
+            // b := inv(L) * b
+            for (int64_t k = 0; k < n; k += block[k]) {
+                const int64_t first = k + block[k];
+                for (int64_t c = k; c < first; ++c) {
+                    for (int64_t i = first; i < n; ++i) {
+                        temp = b[c];
+                        temp *= A[i + c * lda];
+                        b[i] -= temp;
+                    }
+                }
+            }
+            // b := inv(D) * b
+            for (int64_t k = 0; k < n; k += block[k]) {
+                if (block[k] == 1) {
+                    b[k] /= A[k + k * lda];
+                } else {
+                    akm1k = A[(k + 1) + k * lda];
+                    akm1 = A[k + k * lda] / akm1k;
+                    ak = A[(k + 1) + (k + 1) * lda] / akm1k;
+                    denom = akm1 * ak - 1;
+                    bkm1 = b[k] / akm1k;
+                    bk = b[k + 1] / akm1k;
+                    b[k] = (ak * bkm1 - bk) / denom;
+                    b[k + 1] = (akm1 * bk - bkm1) / denom;
+                }
+            }
+            // b := inv(L)^T * b
+            for (int64_t k = n - 1; k >= 0; --k) {
+                const int64_t start = block[k] == 0 ? k - 1 : k;
+                for (int64_t c = start; c <= k; ++c) {
+                    for (int64_t i = k + 1; i < n; ++i) {
+                        temp = b[i];
+                        temp *= A[i + c * lda];
+                        b[c] -= temp;
+                    }
+                }
+                k = start;
+            }
+            // b := P^T * b
+            for (int64_t k = n - 1; k >= 0; --k) {
+                if (block[k] == 1 && ipiv[k] != k) {
+                    b[k].swap(b[ipiv[k]]);
+                } else if (block[k] == 0 && -ipiv[k] - 1 != k) {
+                    b[k].swap(b[-ipiv[k] - 1]);
+                }
+            }
+        }
+    }
+}
+
+// cf. https://netlib.org/lapack/lawnspdf/lawn41.pdf p.121
+inline double flops_sytrf(int64_t n_i) {
+    double n = (double)n_i;
+    double muls = n * n * n / 6.0 + n * n / 2.0 + 10.0 * n / 3.0;
+    double adds = n * n * n / 6.0 - n / 6.0;
+    return muls + adds;
+}
@@ -0,0 +1,346 @@
+/*
+ * Copyright (c) 2026
+ *      Nakata, Maho
+ *      All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ */
+
+#pragma once
+
+// Blocked Householder QR factorization A = Q * R of a column-major
+// mpf_class array, the routines that apply Q, and a least-squares solve.
+//
+// Q is the product H(0) H(1) ... H(k-1) of Householder reflectors
+// H(i) = I - tau[i] * v_i * v_i^T.  v_i has a unit entry at row i, which is
+// not stored, and its entries below the diagonal overwrite column i of A.
+// R overwrites the upper triangle.
+//
+// Rgeqrf factors one panel of Rgeqrf_block_size columns with the unblocked
+// Rgeqr2.  It then folds the panel's reflectors into the compact WY form
+// I - V * T * V^T, where T is ib x ib upper triangular (Rlarft), and
+// applies that to the trailing matrix in one pass (Rlarfb).  Rlarfb computes
+// W := V^T * C, applies the small triangular T to W, and then does
+// C := C - V * W.  V is split as in LAPACK into its unit lower triangle V1
+// and the rectangle V2 below it.  The V2 products hold almost all of the
+// flops and go to Rgemm_packed from ../07_Rtrsm; the V1 and T parts are
+// small loops over the independent columns of C.
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "../07_Rtrsm/Rtrsm.hpp"
+
+inline constexpr int64_t Rgeqrf_block_size = 32;
+
+// Generates H = I - tau * v * v^T with H * (alpha, x)^T = (beta, 0)^T for a
+// vector of length n.  alpha is overwritten by beta, and x by v(1:n-1).
+// tau is 0 when x is already zero.
+inline void Rlarfg(int64_t n, mpf_class &alpha, mpf_class *x, mpf_class &tau) {
+    tau = 0;
+    if (n <= 1) {
+        return;
+    }
+    mpf_class xnorm = 0;
+    mpf_class temp;
+    for (int64_t i = 0; i < n - 1; ++i) {
+        temp = x[i];
+        temp *= x[i];
+        xnorm += temp;
+    }
+    if (xnorm == 0) {
+        return;
+    }
+    mpf_class beta = alpha;
+    beta *= alpha;
+    beta += xnorm;
+    beta = sqrt(beta);
+    if (alpha >= 0) {
+        beta = -beta;
+    }
+    tau = beta;
+    tau -= alpha;
+    tau /= beta;
+    mpf_class scale = alpha;
+    scale -= beta;
+    for (int64_t i = 0; i < n - 1; ++i) {
+        x[i] /= scale;
+    }
+    alpha = beta;
+}
+
+// C := (I - tau * v * v^T) * C for the m x n matrix C, with v(0) = 1 and
+// v(1:m-1) stored at v[1..m).
+inline void Rlarf(int64_t m, int64_t n, const mpf_class *v, const mpf_class &tau, mpf_class *C, int64_t ldc) {
+    if (tau == 0) {
+        return;
+    }
+#if defined(_OPENMP)
+#pragma omp parallel
+#endif
+    {
+        mpf_class w, temp;
+#if defined(_OPENMP)
+#pragma omp for schedule(static)
+#endif
+        for (int64_t j = 0; j < n; ++j) {
+            mpf_class *c = &C[j * ldc];
+            w = c[0];
+            for (int64_t i = 1; i < m; ++i) {
+                temp = v[i];
+                temp *= c[i];
+                w += temp;
+            }
+            w *= tau;
+            c[0] -= w;
+            for (int64_t i = 1; i < m; ++i) {
+                temp = v[i];
+                temp *= w;
+                c[i] -= temp;
+            }
+        }
+    }
+}
+
+// Unblocked Householder QR of the m x n matrix A.
+inline void Rgeqr2(int64_t m, int64_t n, mpf_class *A, int64_t lda, mpf_class *tau) {
+    const int64_t k = std::min(m, n);
+    for (int64_t i = 0; i < k; ++i) {
+        Rlarfg(m - i, A[i + i * lda], &A[(i + 1) + i * lda], tau[i]);
+        if (i + 1 < n) {
+            Rlarf(m - i, n - i - 1, &A[i + i * lda], tau[i], &A[i + (i + 1) * lda], lda);
+        }
+    }
+}
+
+// Forms the k x k upper triangular T with H(0) ... H(k-1) = I - V * T * V^T,
+// where V is the m x k unit lower trapezoid of A.
+inline void Rlarft(int64_t m, int64_t k, const mpf_class *V, int64_t ldv, const mpf_class *tau, mpf_class *T, int64_t ldt) {
+    for (int64_t i = 0; i < k; ++i) {
+        if (tau[i] == 0) {
+            for (int64_t j = 0; j <= i; ++j) {
+                T[j + i * ldt] = 0;
+            }
+            continue;
+        }
+        // T(0:i, i) := -tau[i] * V(i:m, 0:i)^T * v_i
+#if defined(_OPENMP)
+#pragma omp parallel
+#endif
+        {
+            mpf_class temp;
+#if defined(_OPENMP)
+#pragma omp for schedule(static)
+#endif
+            for (int64_t j = 0; j < i; ++j) {
+                mpf_class &t = T[j + i * ldt];
+                t = V[i + j * ldv];
+                for (int64_t l = i + 1; l < m; ++l) {
+                    temp = V[l + j * ldv];
+                    temp *= V[l + i * ldv];
+                    t += temp;
+                }
+                t *= tau[i];
+                t = -t;
+            }
+        }
+        // T(0:i, i) := T(0:i, 0:i) * T(0:i, i); row j only reads rows >= j.
+        mpf_class temp;
+        for (int64_t j = 0; j < i; ++j) {
+            mpf_class &t = T[j + i * ldt];
+            t *= T[j + j * ldt];
+            for (int64_t l = j + 1; l < i; ++l) {
+                temp = T[j + l * ldt];
+                temp *= T[l + i * ldt];
+                t += temp;
+            }
+        }
+        T[i + i * ldt] = tau[i];
+    }
+}
+
+// C := H * C (trans false) or H^T * C (trans true), where
+// H = I - V * T * V^T, V is the m x k unit lower trapezoid, and C is m x n.
+inline void Rlarfb(bool trans, int64_t m, int64_t n, int64_t k, const mpf_class *V, int64_t ldv, const mpf_class *T, int64_t ldt, mpf_class *C, int64_t ldc) {
+    if (m <= 0 || n <= 0 || k <= 0) {
+        return;
+    }
+    const mpf_class one = 1, minus_one = -1;
+    // W is k x n
+    std::vector<mpf_class> W(k * n);
+#if defined(_OPENMP)
+#pragma omp parallel
+#endif
+    {
+        mpf_class temp;
+#if defined(_OPENMP)
+#pragma omp for schedule(static)
+#endif
+        for (int64_t j = 0; j < n; ++j) {
+            const mpf_class *c = &C[j * ldc];
+            mpf_class *w = &W[j * k];
+            // w := V1^T * c(0:k)
+            for (int64_t l = 0; l < k; ++l) {
+                w[l] = c[l];
+                for (int64_t i = l + 1; i < k; ++i) {
+                    temp = V[i + l * ldv];
+                    temp *= c[i];
+                    w[l] += temp;
+                }
+            }
+        }
+    }
+    // W := W + V2^T * C2
+    Rgemm_packed(true, false, k, n, m - k, one, &V[k], ldv, &C[k], ldc, W.data(), k);
+#if defined(_OPENMP)
+#pragma omp parallel
+#endif
+    {
+        mpf_class temp;
+#if defined(_OPENMP)
+#pragma omp for schedule(static)
+#endif
+        for (int64_t j = 0; j < n; ++j) {
+            mpf_class *c = &C[j * ldc];
+            mpf_class *w = &W[j * k];
+            // w := T^T * w or T * w, in place
+            if (trans) {
+                for (int64_t l = k - 1; l >= 0; --l) {
+                    w[l] *= T[l + l * ldt];
+                    for (int64_t p = 0; p < l; ++p) {
+                        temp = T[p + l * ldt];
+                        temp *= w[p];
+                        w[l] += temp;
+                    }
+                }
+            } else {
+                for (int64_t l = 0; l < k; ++l) {
+                    w[l] *= T[l + l * ldt];
+                    for (int64_t p = l + 1; p < k; ++p) {
+                        temp = T[l + p * ldt];
+                        temp *= w[p];
+                        w[l] += temp;
+                    }
+                }
+            }
+            // c(0:k) := c(0:k) - V1 * w
+            for (int64_t l = 0; l < k; ++l) {
+                if (w[l] == 0) {
+                    continue;
+                }
+                c[l] -= w[l];
+                for (int64_t i = l + 1; i < k; ++i) {
+                    temp = V[i + l * ldv];
+                    temp *= w[l];
+                    c[i] -= temp;
+                }
+            }
+        }
+    }
+    // C2 := C2 - V2 * W
+    Rgemm_packed(false, false, m - k, n, k, minus_one, &V[k], ldv, W.data(), k, &C[k], ldc);
+}
+
+// Blocked Householder QR of the m x n matrix A; tau has min(m, n) entries.
+inline void Rgeqrf(int64_t m, int64_t n, mpf_class *A, int64_t lda, mpf_class *tau, int64_t nb = Rgeqrf_block_size) {
+    const int64_t k = std::min(m, n);
+    std::vector<mpf_class> T(nb * nb);
+    for (int64_t i = 0; i < k; i += nb) {
+        const int64_t ib = std::min(nb, k - i);
+        Rgeqr2(m - i, ib, &A[i + i * lda], lda, &tau[i]);
+        if (i + ib < n) {
+            Rlarft(m - i, ib, &A[i + i * lda], lda, &tau[i], T.data(), nb);
+            Rlarfb(true, m - i, n - i - ib, ib, &A[i + i * lda], lda, T.data(), nb, &A[i + (i + ib) * lda], lda);
+        }
+    }
+}
+
+// C := Q * C (trans false) or Q^T * C (trans true) for the m x n matrix C,
+// where Q is the product of the k reflectors stored in the m x k matrix A
+// by Rgeqrf or Rgeqr2.
+inline void Rormqr(bool trans, int64_t m, int64_t n, int64_t k, const mpf_class *A, int64_t lda, const mpf_class *tau, mpf_class *C, int64_t ldc, int64_t nb = Rgeqrf_block_size) {
+    std::vector<mpf_class> T(nb * nb);
+    const int64_t nblocks = (k + nb - 1) / nb;
+    // Q^T = H(k-1) ... H(0) applies the first block first; Q the last.
+    for (int64_t b = 0; b < nblocks; ++b) {
+        const int64_t i = (trans ? b : nblocks - 1 - b) * nb;
+        const int64_t ib = std::min(nb, k - i);
+        Rlarft(m - i, ib, &A[i + i * lda], lda, &tau[i], T.data(), nb);
+        Rlarfb(trans, m - i, n, ib, &A[i + i * lda], lda, T.data(), nb, &C[i], ldc);
+    }
+}
+
+// Least-squares solution of min ||A * X - B|| for the m x n matrix A with
+// m >= n and full column rank.  A is overwritten by its QR factors and
+// B (m x nrhs) by Q^T * B, whose first n rows hold X.  Returns 0, or j + 1
+// when R(j, j) is zero.
+inline int64_t Rgels(int64_t m, int64_t n, int64_t nrhs, mpf_class *A, int64_t lda, mpf_class *B, int64_t ldb, int64_t nb = Rgeqrf_block_size) {
+    std::vector<mpf_class> tau(n);
+    Rgeqrf(m, n, A, lda, tau.data(), nb);
+    for (int64_t j = 0; j < n; ++j) {
+        if (A[j + j * lda] == 0) {
+            return j + 1;
+        }
+    }
+    const mpf_class one = 1;
+    Rormqr(true, m, nrhs, n, A, lda, tau.data(), B, ldb, nb);
+    Rtrsm('L', 'U', 'N', 'N', n, nrhs, one, A, lda, B, ldb);
+    return 0;
+}
+
+// cf. https://netlib.org/lapack/lawnspdf/lawn41.pdf p.121, m >= n
+inline double flops_geqrf(int64_t m_i, int64_t n_i) {
+    double m = (double)m_i;
+    double n = (double)n_i;
+    double muls = n * (n * (0.5 - n / 3.0 + m) + m + 23.0 / 6.0);
+    double adds = n * (n * (0.5 - n / 3.0 + m) + 5.0 / 6.0);
+    return muls + adds;
+}
+
+// L1 norm of A^T * (b - A * x) for the m x n matrix A.  It vanishes at the
+// least-squares solution even when b is not in the range of A.
+inline mpf_class Rgels_residual(int64_t m, int64_t n, const mpf_class *A, int64_t lda, const mpf_class *x, const mpf_class *b) {
+    std::vector<mpf_class> r(m);
+    mpf_class temp;
+    for (int64_t i = 0; i < m; ++i) {
+        r[i] = b[i];
+        for (int64_t j = 0; j < n; ++j) {
+            temp = A[i + j * lda];
+            temp *= x[j];
+            r[i] -= temp;
+        }
+    }
+    mpf_class norm = 0;
+    mpf_class g;
+    for (int64_t j = 0; j < n; ++j) {
+        g = 0;
+        for (int64_t i = 0; i < m; ++i) {
+            temp = A[i + j * lda];
+            temp *= r[i];
+            g += temp;
+        }
+        norm += abs(g);
+    }
+    return norm;
+}
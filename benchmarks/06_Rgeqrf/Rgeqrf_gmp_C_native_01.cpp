@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2026
+ *      Nakata, Maho
+ *      All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ */
+
+#include <iostream>
+#include <chrono>
+#include <cstdlib>
+#include <gmp.h>
+
+#if defined USE_ORIGINAL_GMPXX
+#include <gmpxx.h>
+#else
+#include "gmpxx_mkII.h"
+#if !defined ___GMPXX_STRICT_COMPATIBILITY___
+using namespace gmpxx;
+#endif
+#endif
+
+#include "Rgeqrf.hpp"
+
+#define MFLOPS 1e+6
+
+gmp_randstate_t state;
+
+// Unblocked Householder QR on mpf_t
+void _Rgeqrf(int64_t m, int64_t n, mpf_t *A, int64_t lda, mpf_t *tau, int prec) {
+    mpf_t xnorm, beta, scale, temp;
+    mpf_init2(xnorm, prec);
+    mpf_init2(beta, prec);
+    mpf_init2(scale, prec);
+    mpf_init2(temp, prec);
+    const int64_t k = m < n ? m : n;
+    for (int64_t i = 0; i < k; ++i) {
+        // Generate the reflector for column i
+        mpf_t *v = &A[i + i * lda];
+        mpf_set_ui(tau[i], 0);
+        mpf_set_ui(xnorm, 0);
+        for (int64_t l = 1; l < m - i; ++l) {
+            mpf_mul(temp, v[l], v[l]);
+            mpf_add(xnorm, xnorm, temp);
+        }
+        if (mpf_sgn(xnorm) == 0) {
+            continue;
+        }
+        mpf_mul(beta, v[0], v[0]);
+        mpf_add(beta, beta, xnorm);
+        mpf_sqrt(beta, beta);
+        if (mpf_sgn(v[0]) >= 0) {
+            mpf_neg(beta, beta);
+        }
+        mpf_sub(tau[i], beta, v[0]);
+        mpf_div(tau[i], tau[i], beta);
+        mpf_sub(scale, v[0], beta);
+        for (int64_t l = 1; l < m - i; ++l) {
+            mpf_div(v[l], v[l], scale);
+        }
+        mpf_set(v[0], beta);
+
+        // Apply it to the trailing columns; v(0) is 1
+        mpf_t w;
+        mpf_init2(w, prec);
+        for (int64_t j = i + 1; j < n; ++j) {
+            mpf_t *c = &A[i + j * lda];
+            mpf_set(w, c[0]);
+            for (int64_t l = 1; l < m - i; ++l) {
+                mpf_mul(temp, v[l], c[l]);
+                mpf_add(w, w, temp);
+            }
+            mpf_mul(w, w, tau[i]);
+            mpf_sub(c[0], c[0], w);
+            for (int64_t l = 1; l < m - i; ++l) {
+                mpf_mul(temp, v[l], w);
+                mpf_sub(c[l], c[l], temp);
+            }
+        }
+        mpf_clear(w);
+    }
+    mpf_clear(xnorm);
+    mpf_clear(beta);
+    mpf_clear(scale);
+    mpf_clear(temp);
+}
+
+int main(int argc, char **argv) {
+    gmp_randinit_default(state);
+    gmp_randseed_ui(state, 42);
+
+    if (argc != 4) {
+        std::cerr << "Usage: " << argv[0] << " <rows m> <columns n> <precision>" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    int64_t m = std::atoll(argv[1]);
+    int64_t n = std::atoll(argv[2]);
+    int prec = std::atoi(argv[3]);
+    if (m < n) {
+        std::cerr << "The least-squares solve needs m >= n" << std::endl;
+        return EXIT_FAILURE;
+    }
+    mpf_set_default_prec(prec);
+#if !defined USE_ORIGINAL_GMPXX
+    gmpxx::gmpxx_defaults::set_initial_default_prec(prec);
+#endif
+
+    int64_t lda = m; // Leading dimension for A
+    mpf_t *F = new mpf_t[m * n];
+    mpf_t *tau = new mpf_t[n];
+    for (int64_t j = 0; j < n; ++j) {
+        for (int64_t i = 0; i < m; ++i) {
+            mpf_init2(F[i + j * lda], prec);
+            mpf_urandomb(F[i + j * lda], state, prec); // 0 <= F[i + j*lda] < 1
+        }
+        mpf_init2(tau[j], prec);
+    }
+
+    // Keep A and b as mpf_class for the solve and the residual
+    mpf_class *A = new mpf_class[m * n];
+    mpf_class *b = new mpf_class[m];
+    mpf_class *x = new mpf_class[m];
+    for (int64_t j = 0; j < n; ++j) {
+        for (int64_t i = 0; i < m; ++i) {
+            A[i + j * lda] = mpf_class(F[i + j * lda]);
+        }
+    }
+    mpf_t value;
+    mpf_init2(value, prec);
+    for (int64_t i = 0; i < m; ++i) {
+        mpf_urandomb(value, state, prec);
+        b[i] = mpf_class(value);
+        x[i] = b[i];
+    }
+    mpf_clear(value);
+
+    // Perform _Rgeqrf
+    auto start = std::chrono::high_resolution_clock::now();
+    _Rgeqrf(m, n, F, lda, tau, prec);
+    auto end = std::chrono::high_resolution_clock::now();
+
+    // Least-squares solve with the factors
+    mpf_class *F_mpf_class = new mpf_class[m * n];
+    mpf_class *tau_mpf_class = new mpf_class[n];
+    for (int64_t j = 0; j < n; ++j) {
+        for (int64_t i = 0; i < m; ++i) {
+            F_mpf_class[i + j * lda] = mpf_class(F[i + j * lda]);
+        }
+        tau_mpf_class[j] = mpf_class(tau[j]);
+    }
+    Rormqr(true, m, 1, n, F_mpf_class, lda, tau_mpf_class, x, m);
+    Rtrsm('L', 'U', 'N', 'N', n, 1, mpf_class(1), F_mpf_class, lda, x, m);
+
+    std::chrono::duration<double> elapsed_seconds = end - start;
+    double mflops = flops_geqrf(m, n) / (elapsed_seconds.count() * MFLOPS);
+
+    std::cout << "Elapsed time: " << elapsed_seconds.count() << " s" << std::endl;
+    std::cout << "MFLOPS: " << mflops << std::endl;
+
+    mpf_class l1_norm = Rgels_residual(m, n, A, lda, x, b);
+    std::cout << "L1 Norm of residual: ";
+    gmp_printf("%.4Fe\n", l1_norm.get_mpf_t());
+
+    mpf_class threshold = 1e-5;
+    if (l1_norm < threshold) {
+        std::cout << "Result OK" << std::endl;
+    } else {
+        std::cout << "Result NG" << std::endl;
+    }
+
+    // Clear memory
+    for (int64_t j = 0; j < n; ++j) {
+        for (int64_t i = 0; i < m; ++i) {
+            mpf_clear(F[i + j * lda]);
+        }
+        mpf_clear(tau[j]);
+    }
+    delete[] F;
+    delete[] tau;
+    delete[] F_mpf_class;
+    delete[] tau_mpf_class;
+    delete[] A;
+    delete[] b;
+    delete[] x;
+
+    gmp_randclear(state);
+
+    return EXIT_SUCCESS;
+}
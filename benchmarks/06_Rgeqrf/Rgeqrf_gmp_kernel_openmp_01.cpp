@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2026
+ *      Nakata, Maho
+ *      All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ */
+
+#include <iostream>
+#include <chrono>
+#include <cstdlib>
+#include <vector>
+
+#if defined USE_ORIGINAL_GMPXX
+#include <gmpxx.h>
+#else
+#include "gmpxx_mkII.h"
+#if !defined ___GMPXX_STRICT_COMPATIBILITY___
+using namespace gmpxx;
+#endif
+#endif
+
+#include "Rgeqrf.hpp"
+
+#define MFLOPS 1e+6
+
+#include <omp.h>
+
+// Blocked Householder QR with the block reflector parallelized over the
+// trailing columns.
+void _Rgeqrf(int64_t m, int64_t n, mpf_class *A, int64_t lda, mpf_class *tau) {
+    Rgeqrf(m, n, A, lda, tau);
+}
+
+int main(int argc, char **argv) {
+    // Initialize random state
+    gmp_randclass r(gmp_randinit_default);
+    r.seed(42);
+
+    // Check command-line arguments
+    if (argc != 4) {
+        std::cerr << "Usage: " << argv[0] << " <rows m> <columns n> <precision>" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    int64_t M = std::atoll(argv[1]); // Rows of A
+    int64_t N = std::atoll(argv[2]); // Columns of A
+    int prec = std::atoi(argv[3]);   // Precision in bits
+    if (M < N) {
+        std::cerr << "The least-squares solve needs m >= n" << std::endl;
+        return EXIT_FAILURE;
+    }
+    mpf_set_default_prec(prec);
+#if !defined USE_ORIGINAL_GMPXX
+    gmpxx::gmpxx_defaults::set_initial_default_prec(prec);
+#endif
+
+    // A (M x N) is kept for the residual; F is factored in place
+    mpf_class *A = new mpf_class[M * N];
+    mpf_class *F = new mpf_class[M * N];
+    mpf_class *tau = new mpf_class[N];
+    mpf_class *b = new mpf_class[M];
+    mpf_class *x = new mpf_class[M];
+
+    for (int64_t j = 0; j < N; ++j) {
+        for (int64_t i = 0; i < M; ++i) {
+            A[i + j * M] = r.get_f(prec);
+            F[i + j * M] = A[i + j * M];
+        }
+    }
+    // b is not in the range of A when M > N
+    for (int64_t i = 0; i < M; ++i) {
+        b[i] = r.get_f(prec);
+        x[i] = b[i];
+    }
+
+    // Perform _Rgeqrf
+    auto start = std::chrono::high_resolution_clock::now();
+    _Rgeqrf(M, N, F, M, tau);
+    auto end = std::chrono::high_resolution_clock::now();
+
+    // Least-squares solve: x := inv(R) * (Q^T * b)(0:N)
+    auto solve_start = std::chrono::high_resolution_clock::now();
+    Rormqr(true, M, 1, N, F, M, tau, x, M);
+    Rtrsm('L', 'U', 'N', 'N', N, 1, mpf_class(1), F, M, x, M);
+    auto solve_end = std::chrono::high_resolution_clock::now();
+
+    std::chrono::duration<double> elapsed = end - start;
+    std::chrono::duration<double> solve_elapsed = solve_end - solve_start;
+    double mflops = flops_geqrf(M, N) / (elapsed.count() * MFLOPS);
+
+    // Output performance metrics
+    std::cout << "Elapsed time: " << elapsed.count() << " s" << std::endl;
+    std::cout << "Solve time: " << solve_elapsed.count() << " s" << std::endl;
+    std::cout << "MFLOPS: " << mflops << std::endl;
+
+    // L1 norm of the normal-equation residual A^T (b - A x)
+    mpf_class l1_norm = Rgels_residual(M, N, A, M, x, b);
+    std::cout << "L1 Norm of residual: ";
+    gmp_printf("%.4Fg\n", l1_norm.get_mpf_t());
+
+    // Verify correctness
+    mpf_class threshold = 1e-5;
+    if (l1_norm < threshold) {
+        std::cout << "Result OK" << std::endl;
+    } else {
+        std::cout << "Result NG" << std::endl;
+    }
+
+    // Clean up
+    delete[] A;
+    delete[] F;
+    delete[] tau;
+    delete[] b;
+    delete[] x;
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2026
+ *      Nakata, Maho
+ *      All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ */
+
+#pragma once
+
+// Packed tile engine shared by the level-3 kernels in this directory:
+// C := C + alpha * op(A) * op(B) on column-major mpf_class or mpf_t arrays,
+// with op(X) = X or X^T.
+//
+// C is split into Rgemm_packed_mb x Rgemm_packed_nb tiles, and the inner
+// dimension into Rgemm_packed_kb slices.  For each tile and slice, the
+// operands are packed into contiguous panels, and one micro-kernel runs on
+// the panels.  Packing copies pointers, not mpf values: it costs no
+// allocation, and it removes the transpose and the leading dimension from
+// the micro-kernel, so one loop serves all four op(A), op(B) combinations
+// and the triangular variants that Rsyrk needs.  Because packing is that
+// cheap, each tile packs its own panels.  Tiles are then independent, and
+// the callers schedule them over OpenMP threads.
+//
+// The panels hold mpf_srcptr, and the micro-kernel writes C through
+// mpf_ptr, so the same code runs on mpf_class arrays and on the raw mpf_t
+// tiles of ../11_Rooc/Rtiled.hpp.
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <vector>
+
+#include <gmp.h>
+
+inline constexpr int64_t Rgemm_packed_mb = 64;
+inline constexpr int64_t Rgemm_packed_nb = 64;
+inline constexpr int64_t Rgemm_packed_kb = 64;
+
+// Case-insensitive match of a BLAS option character.
+inline bool Rgemm_packed_lsame(char a, char b) { return std::toupper((unsigned char)a) == std::toupper((unsigned char)b); }
+
+// Which part of a tile the micro-kernel updates.  The triangular shapes
+// apply to square tiles on the diagonal of C.
+enum class Rgemm_packed_shape { full, lower, upper };
+
+// The GMP view of an entry.  An mpf_t entry decays to the pointer.
+inline mpf_srcptr Rgemm_packed_src(const mpf_class &x) { return x.get_mpf_t(); }
+inline mpf_srcptr Rgemm_packed_src(mpf_srcptr x) { return x; }
+inline mpf_ptr Rgemm_packed_dst(mpf_class &x) { return x.get_mpf_t(); }
+inline mpf_ptr Rgemm_packed_dst(mpf_ptr x) { return x; }
+
+// panel[i + l * rows] = &op(X)(i, l) for the rows x cols block op(X).
+template <class Elem> inline void Rgemm_pack(bool trans, int64_t rows, int64_t cols, const Elem *X, int64_t ldx, mpf_srcptr *panel) {
+    for (int64_t l = 0; l < cols; ++l) {
+        for (int64_t i = 0; i < rows; ++i) {
+            panel[i + l * rows] = Rgemm_packed_src(trans ? X[l + i * ldx] : X[i + l * ldx]);
+        }
+    }
+}
+
+// C := C + alpha * Ap * Bp, with Ap m x k and Bp k x n packed panels.
+template <class Elem> inline void Rgemm_micro(Rgemm_packed_shape shape, int64_t m, int64_t n, int64_t k, mpf_srcptr alpha, const mpf_srcptr *Ap, const mpf_srcptr *Bp, Elem *C, int64_t ldc, mpf_ptr temp, mpf_ptr templ) {
+    for (int64_t j = 0; j < n; ++j) {
+        const int64_t i0 = shape == Rgemm_packed_shape::lower ? j : 0;
+        const int64_t i1 = shape == Rgemm_packed_shape::upper ? j + 1 : m;
+        for (int64_t l = 0; l < k; ++l) {
+            mpf_mul(temp, alpha, Bp[l + j * k]);
+            if (mpf_sgn(temp) == 0) {
+                continue;
+            }
+            for (int64_t i = i0; i < i1; ++i) {
+                mpf_ptr c = Rgemm_packed_dst(C[i + j * ldc]);
+                mpf_mul(templ, temp, Ap[i + l * m]);
+                mpf_add(c, c, templ);
+            }
+        }
+    }
+}
+
+// Per-thread panels and scratch values for Rgemm_tile.  The scratch values
+// hold prec bits, which should be the precision of C.
+struct Rgemm_packed_workspace {
+    std::vector<mpf_srcptr> Ap;
+    std::vector<mpf_srcptr> Bp;
+    mpf_class temp, templ;
+
+    explicit Rgemm_packed_workspace(mp_bitcnt_t prec = mpf_get_default_prec()) : Ap(Rgemm_packed_mb * Rgemm_packed_kb), Bp(Rgemm_packed_kb * Rgemm_packed_nb), temp(0, prec), templ(0, prec) {}
+};
+
+// One tile of C := C + alpha * op(A) * op(B), with m <= Rgemm_packed_mb and
+// n <= Rgemm_packed_nb.  A and B point at the tile's rows of op(A) and
+// columns of op(B); k is the full inner dimension.  Elem is mpf_class or
+// mpf_t, and alpha either one or an mpf_srcptr.
+template <class Scalar, class Elem> inline void Rgemm_tile(Rgemm_packed_shape shape, bool transa, bool transb, int64_t m, int64_t n, int64_t k, const Scalar &alpha, const Elem *A, int64_t lda, const Elem *B, int64_t ldb, Elem *C, int64_t ldc, Rgemm_packed_workspace &work) {
+    for (int64_t l = 0; l < k; l += Rgemm_packed_kb) {
+        const int64_t kb = std::min(Rgemm_packed_kb, k - l);
+        Rgemm_pack(transa, m, kb, transa ? &A[l] : &A[l * lda], lda, work.Ap.data());
+        Rgemm_pack(transb, kb, n, transb ? &B[l * ldb] : &B[l], ldb, work.Bp.data());
+        Rgemm_micro(shape, m, n, kb, Rgemm_packed_src(alpha), work.Ap.data(), work.Bp.data(), C, ldc, work.temp.get_mpf_t(), work.templ.get_mpf_t());
+    }
+}
+
+// C := C + alpha * op(A) * op(B), with op(A) m x k, op(B) k x n, and C m x n.
+template <class Scalar, class Elem> inline void Rgemm_packed(bool transa, bool transb, int64_t m, int64_t n, int64_t k, const Scalar &alpha, const Elem *A, int64_t lda, const Elem *B, int64_t ldb, Elem *C, int64_t ldc) {
+    if (m <= 0 || n <= 0 || k <= 0) {
+        return;
+    }
+    const mp_bitcnt_t prec = mpf_get_prec(Rgemm_packed_src(C[0]));
+    const int64_t mt = (m + Rgemm_packed_mb - 1) / Rgemm_packed_mb;
+    const int64_t nt = (n + Rgemm_packed_nb - 1) / Rgemm_packed_nb;
+#if defined(_OPENMP)
+#pragma omp parallel
+#endif
+    {
+        Rgemm_packed_workspace work(prec);
+#if defined(_OPENMP)
+#pragma omp for collapse(2) schedule(static)
+#endif
+        for (int64_t jt = 0; jt < nt; ++jt) {
+            for (int64_t it = 0; it < mt; ++it) {
+                const int64_t i = it * Rgemm_packed_mb;
+                const int64_t j = jt * Rgemm_packed_nb;
+                const int64_t mb = std::min(Rgemm_packed_mb, m - i);
+                const int64_t nb = std::min(Rgemm_packed_nb, n - j);
+                Rgemm_tile(Rgemm_packed_shape::full, transa, transb, mb, nb, k, alpha, transa ? &A[i * lda] : &A[i], lda, transb ? &B[j] : &B[j * ldb], ldb, &C[i + j * ldc], ldc, work);
+            }
+        }
+    }
+}
@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2026
+ *      Nakata, Maho
+ *      All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ */
+
+#pragma once
+
+// Blocked symmetric rank-k update of one triangle,
+//
+//   C := alpha * A * A^T + beta * C   (trans 'N', A n x k)
+//   C := alpha * A^T * A + beta * C   (trans 'T'/'C', A k x n)
+//
+// on column-major mpf_class arrays.  Only the triangle of C named by uplo
+// is read or written.
+//
+// The work is done by Rgemmt, the same triangle of
+// C := alpha * op(A) * op(B) + beta * C for a product known to be
+// symmetric; Rsyrk passes B = A, and the factorizations pass B = L * D.
+// The triangle is covered by square tiles of Rgemm_packed_nb.  Each tile is
+// one Rgemm_tile call over the full inner dimension: the tiles on the
+// diagonal use the triangular micro-kernel shape, and the others are
+// ordinary gemm tiles.  The tiles are independent, and they are scheduled
+// dynamically over OpenMP threads, because the tile count per block column
+// varies along the triangle.
+
+#include <utility>
+#include <vector>
+
+#include "Rgemm_packed.hpp"
+
+static_assert(Rgemm_packed_mb == Rgemm_packed_nb, "Rsyrk needs square tiles");
+
+// Unblocked reference: the kernel_03 loop restricted to the triangle.
+inline void Rsyrk_unblocked(char uplo, char trans, int64_t n, int64_t k, const mpf_class &alpha, const mpf_class *A, int64_t lda, const mpf_class &beta, mpf_class *C, int64_t ldc) {
+    const bool upper = Rgemm_packed_lsame(uplo, 'U');
+    const bool tr = !Rgemm_packed_lsame(trans, 'N');
+    auto a = [&](int64_t i, int64_t l) -> const mpf_class & { return tr ? A[l + i * lda] : A[i + l * lda]; };
+#if defined(_OPENMP)
+#pragma omp parallel
+#endif
+    {
+        mpf_class temp, templ;
+#if defined(_OPENMP)
+#pragma omp for schedule(dynamic)
+#endif
+        for (int64_t j = 0; j < n; ++j) {
+            const int64_t i0 = upper ? 0 : j;
+            const int64_t i1 = upper ? j + 1 : n;
+            for (int64_t i = i0; i < i1; ++i) {
+                C[i + j * ldc] *= beta;
+            }
+            for (int64_t l = 0; l < k; ++l) {
+                temp = alpha;
+                temp *= a(j, l);
+                if (temp == 0) {
+                    continue;
+                }
+                for (int64_t i = i0; i < i1; ++i) {
+                    templ = temp;
+                    templ *= a(i, l);
+                    C[i + j * ldc] += templ;
+                }
+            }
+        }
+    }
+}
+
+// Blocked update of the n x n triangle of C := alpha * op(A) * op(B) +
+// beta * C, with op(A) n x k and op(B) k x n.
+inline void Rgemmt(char uplo, char transa, char transb, int64_t n, int64_t k, const mpf_class &alpha, const mpf_class *A, int64_t lda, const mpf_class *B, int64_t ldb, const mpf_class &beta, mpf_class *C, int64_t ldc) {
+    if (n <= 0) {
+        return;
+    }
+    const bool upper = Rgemm_packed_lsame(uplo, 'U');
+    const bool ta = !Rgemm_packed_lsame(transa, 'N');
+    const bool tb = !Rgemm_packed_lsame(transb, 'N');
+    const int64_t nb = Rgemm_packed_nb;
+    const int64_t nt = (n + nb - 1) / nb;
+    // Tile (it, jt) of the triangle, in column order
+    std::vector<std::pair<int64_t, int64_t>> tiles;
+    tiles.reserve(nt * (nt + 1) / 2);
+    for (int64_t jt = 0; jt < nt; ++jt) {
+        for (int64_t it = upper ? 0 : jt; it < (upper ? jt + 1 : nt); ++it) {
+            tiles.emplace_back(it, jt);
+        }
+    }
+    const bool update = alpha != 0 && k > 0;
+#if defined(_OPENMP)
+#pragma omp parallel
+#endif
+    {
+        Rgemm_packed_workspace work;
+#if defined(_OPENMP)
+#pragma omp for schedule(dynamic)
+#endif
+        for (int64_t t = 0; t < (int64_t)tiles.size(); ++t) {
+            const int64_t i = tiles[t].first * nb;
+            const int64_t j = tiles[t].second * nb;
+            const int64_t mb = std::min(nb, n - i);
+            const int64_t jb = std::min(nb, n - j);
+            Rgemm_packed_shape shape = Rgemm_packed_shape::full;
+            if (i == j) {
+                shape = upper ? Rgemm_packed_shape::upper : Rgemm_packed_shape::lower;
+            }
+            mpf_class *Cij = &C[i + j * ldc];
+            for (int64_t jj = 0; jj < jb; ++jj) {
+                const int64_t i0 = shape == Rgemm_packed_shape::lower ? jj : 0;
+                const int64_t i1 = shape == Rgemm_packed_shape::upper ? jj + 1 : mb;
+                for (int64_t ii = i0; ii < i1; ++ii) {
+                    if (beta == 0) {
+                        Cij[ii + jj * ldc] = 0;
+                    } else if (beta != 1) {
+                        Cij[ii + jj * ldc] *= beta;
+                    }
+                }
+            }
+            if (update) {
+                // op(A)(i:, :) times op(B)(:, j:)
+                Rgemm_tile(shape, ta, tb, mb, jb, k, alpha, ta ? &A[i * lda] : &A[i], lda, tb ? &B[j] : &B[j * ldb], ldb, Cij, ldc, work);
+            }
+        }
+    }
+}
+
+// Blocked update of the n x n triangle of C.
+inline void Rsyrk(char uplo, char trans, int64_t n, int64_t k, const mpf_class &alpha, const mpf_class *A, int64_t lda, const mpf_class &beta, mpf_class *C, int64_t ldc) {
+    const bool tr = !Rgemm_packed_lsame(trans, 'N');
+    Rgemmt(uplo, tr ? 'T' : 'N', tr ? 'N' : 'T', n, k, alpha, A, lda, A, lda, beta, C, ldc);
+}
+
+// cf. https://netlib.org/lapack/lawnspdf/lawn41.pdf p.120
+inline double flops_syrk(int64_t n_i, int64_t k_i) {
+    double n = (double)n_i;
+    double k = (double)k_i;
+    double muls = 0.5 * k * n * (n + 1.0);
+    double adds = 0.5 * k * n * (n + 1.0);
+    return muls + adds;
+}
+
+// Straightforward reference for checking the kernels, in the style of the
+// Rgemm reference: one dot product per entry of the triangle.
+inline void Rsyrk_reference(char uplo, char trans, int64_t n, int64_t k, const mpf_class &alpha, const mpf_class *A, int64_t lda, const mpf_class &beta, mpf_class *C, int64_t ldc) {
+    const bool upper = Rgemm_packed_lsame(uplo, 'U');
+    const bool tr = !Rgemm_packed_lsame(trans, 'N');
+    mpf_class temp;
+    for (int64_t j = 0; j < n; ++j) {
+        for (int64_t i = upper ? 0 : j; i < (upper ? j + 1 : n); ++i) {
+            temp = 0;
+            for (int64_t l = 0; l < k; ++l) {
+                if (tr) {
+                    temp += A[l + i * lda] * A[l + j * lda];
+                } else {
+                    temp += A[i + l * lda] * A[j + l * lda];
+                }
+            }
+            C[i + j * ldc] = alpha * temp + beta * C[i + j * ldc];
+        }
+    }
+}
+
+// Runs Rsyrk against Rsyrk_reference for all four uplo and trans
+// combinations on a random n x n triangle, with n large enough to span
+// several tiles, and returns the largest L1 norm of the difference.  The
+// other triangle must come back unchanged.
+inline mpf_class Rsyrk_sweep(gmp_randclass &r, int prec, int64_t n = 2 * Rgemm_packed_nb + 5, int64_t k = 7) {
+    const char uplos[] = {'L', 'U'};
+    const char transes[] = {'N', 'T'};
+    std::vector<mpf_class> A(n * k), C(n * n), C_ref(n * n);
+    mpf_class worst = 0;
+    mpf_class norm;
+    for (char uplo : uplos) {
+        for (char trans : transes) {
+            const int64_t lda = trans == 'N' ? n : k;
+            const mpf_class alpha = r.get_f(prec);
+            const mpf_class beta = r.get_f(prec);
+            for (int64_t i = 0; i < n * k; ++i) {
+                A[i] = r.get_f(prec);
+            }
+            for (int64_t i = 0; i < n * n; ++i) {
+                C[i] = r.get_f(prec);
+                C_ref[i] = C[i];
+            }
+            Rsyrk(uplo, trans, n, k, alpha, A.data(), lda, beta, C.data(), n);
+            Rsyrk_reference(uplo, trans, n, k, alpha, A.data(), lda, beta, C_ref.data(), n);
+            norm = 0;
+            for (int64_t i = 0; i < n * n; ++i) {
+                norm += abs(C[i] - C_ref[i]);
+            }
+            if (norm > worst) {
+                worst = norm;
+            }
+        }
+    }
+    return worst;
+}
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2026
+ *      Nakata, Maho
+ *      All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ */
+
+#include <iostream>
+#include <chrono>
+#include <cstdlib>
+
+#if defined USE_ORIGINAL_GMPXX
+#include <gmpxx.h>
+#else
+#include "gmpxx_mkII.h"
+#if !defined ___GMPXX_STRICT_COMPATIBILITY___
+using namespace gmpxx;
+#endif
+#endif
+
+#include "Rsyrk.hpp"
+
+#define MFLOPS 1e+6
+
+// Unblocked update: the kernel_03 loop restricted to the lower triangle.
+void _Rsyrk(int64_t n, int64_t k, const mpf_class &alpha, const mpf_class *A, int64_t lda, const mpf_class &beta, mpf_class *C, int64_t ldc) {
+    Rsyrk_unblocked('L', 'N', n, k, alpha, A, lda, beta, C, ldc);
+}
+
+int main(int argc, char **argv) {
+    // Initialize random state
+    gmp_randclass r(gmp_randinit_default);
+    r.seed(42);
+
+    // Check command-line arguments
+    if (argc != 4) {
+        std::cerr << "Usage: " << argv[0] << " <rows n> <cols k> <precision>" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    int64_t N = std::atoll(argv[1]); // Order of C and rows of A
+    int64_t K = std::atoll(argv[2]); // Columns of A
+    int prec = std::atoi(argv[3]);   // Precision in bits
+    mpf_set_default_prec(prec);
+#if !defined USE_ORIGINAL_GMPXX
+    gmpxx::gmpxx_defaults::set_initial_default_prec(prec);
+#endif
+
+    // Allocate memory for A (N x K), C (N x N), and reference C (C_ref)
+    mpf_class *A = new mpf_class[N * K];
+    mpf_class *C = new mpf_class[N * N];
+    mpf_class *C_ref = new mpf_class[N * N];
+
+    // Initialize scalars alpha and beta with random values
+    mpf_class alpha = r.get_f(prec);
+    mpf_class beta = r.get_f(prec);
+
+    for (int64_t j = 0; j < K; ++j) {
+        for (int64_t i = 0; i < N; ++i) {
+            A[i + j * N] = r.get_f(prec);
+        }
+    }
+    for (int64_t j = 0; j < N; ++j) {
+        for (int64_t i = 0; i < N; ++i) {
+            C[i + j * N] = r.get_f(prec);
+            C_ref[i + j * N] = C[i + j * N];
+        }
+    }
+
+    // Perform _Rsyrk on the lower triangle: C := alpha * A * A^T + beta * C
+    auto start = std::chrono::high_resolution_clock::now();
+    _Rsyrk(N, K, alpha, A, N, beta, C, N);
+    auto end = std::chrono::high_resolution_clock::now();
+
+    // Perform reference computation
+    Rsyrk_reference('L', 'N', N, K, alpha, A, N, beta, C_ref, N);
+
+    std::chrono::duration<double> elapsed = end - start;
+    double mflops = flops_syrk(N, K) / (elapsed.count() * MFLOPS);
+
+    // Output performance metrics
+    std::cout << "Elapsed time: " << elapsed.count() << " s" << std::endl;
+    std::cout << "MFLOPS: " << mflops << std::endl;
+
+    // L1 norm of C - C_ref; the strict upper triangle must be untouched
+    mpf_class l1_norm = 0;
+    for (int64_t j = 0; j < N; ++j) {
+        for (int64_t i = 0; i < N; ++i) {
+            mpf_class diff = abs(C[i + j * N] - C_ref[i + j * N]);
+            l1_norm += diff;
+        }
+    }
+
+    // Output L1 norm
+    std::cout << "L1 Norm of difference: ";
+    gmp_printf("%.4Fg\n", l1_norm.get_mpf_t());
+
+    // Verify correctness
+    mpf_class threshold = 1e-5;
+    if (l1_norm < threshold) {
+        std::cout << "Result OK" << std::endl;
+    } else {
+        std::cout << "Result NG" << std::endl;
+    }
+
+    // Clean up
+    delete[] A;
+    delete[] C;
+    delete[] C_ref;
+
+    return EXIT_SUCCESS;
+}
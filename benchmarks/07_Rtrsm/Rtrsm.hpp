@@ -0,0 +1,273 @@
+/*
+ * Copyright (c) 2026
+ *      Nakata, Maho
+ *      All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ */
+
+#pragma once
+
+// Blocked triangular solve with multiple right-hand sides,
+//
+//   B := alpha * inv(op(A)) * B   (side 'L')
+//   B := alpha * B * inv(op(A))   (side 'R')
+//
+// for every side, uplo ('L'/'U'), transa ('N'/'T'/'C') and diag ('N'/'U')
+// combination, on column-major mpf_class arrays.  op(A) = A or A^T, so a
+// transposed upper triangle is solved as a lower one and the reverse.  That
+// leaves four cases, forward or backward, from the left or the right.
+//
+// Rtrsm walks the diagonal of A in blocks of Rtrsm_block_size.  Each
+// diagonal block is solved with the unblocked Rtrsm_unblocked, which is
+// parallel over the independent columns (left) or rows (right) of B.  The
+// block's contribution is then removed from the rest of B with
+// Rgemm_packed, which holds almost all of the flops.
+
+#include <vector>
+
+#include "Rgemm_packed.hpp"
+
+inline constexpr int64_t Rtrsm_block_size = Rgemm_packed_mb;
+
+// Unblocked solve with op(A) lower (lower true) or upper triangular; a(i, j)
+// reads op(A)(i, j).
+inline void Rtrsm_unblocked(bool left, bool lower, bool trans, bool unit, int64_t m, int64_t n, const mpf_class *A, int64_t lda, mpf_class *B, int64_t ldb) {
+    auto a = [&](int64_t i, int64_t j) -> const mpf_class & { return trans ? A[j + i * lda] : A[i + j * lda]; };
+    if (left) {
+#if defined(_OPENMP)
+#pragma omp parallel
+#endif
+        {
+            mpf_class temp;
+#if defined(_OPENMP)
+#pragma omp for schedule(static)
+#endif
+            for (int64_t j = 0; j < n; ++j) {
+                mpf_class *b = &B[j * ldb];
+                for (int64_t s = 0; s < m; ++s) {
+                    const int64_t k = lower ? s : m - 1 - s;
+                    if (b[k] == 0) {
+                        continue;
+                    }
+                    if (!unit) {
+                        b[k] /= a(k, k);
+                    }
+                    const int64_t i0 = lower ? k + 1 : 0;
+                    const int64_t i1 = lower ? m : k;
+                    for (int64_t i = i0; i < i1; ++i) {
+                        temp = b[k];
+                        temp *= a(i, k);
+                        b[i] -= temp;
+                    }
+                }
+            }
+        }
+    } else {
+#if defined(_OPENMP)
+#pragma omp parallel
+#endif
+        {
+            mpf_class temp;
+#if defined(_OPENMP)
+#pragma omp for schedule(static)
+#endif
+            for (int64_t i = 0; i < m; ++i) {
+                for (int64_t s = 0; s < n; ++s) {
+                    const int64_t j = lower ? n - 1 - s : s;
+                    const int64_t l0 = lower ? j + 1 : 0;
+                    const int64_t l1 = lower ? n : j;
+                    for (int64_t l = l0; l < l1; ++l) {
+                        temp = B[i + l * ldb];
+                        temp *= a(l, j);
+                        B[i + j * ldb] -= temp;
+                    }
+                    if (!unit) {
+                        B[i + j * ldb] /= a(j, j);
+                    }
+                }
+            }
+        }
+    }
+}
+
+// B := alpha * B, with the LAPACK convention that alpha = 0 does not read B.
+inline void Rtrsm_scale(int64_t m, int64_t n, const mpf_class &alpha, mpf_class *B, int64_t ldb) {
+    if (alpha == 1) {
+        return;
+    }
+    const bool zero = alpha == 0;
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(static)
+#endif
+    for (int64_t j = 0; j < n; ++j) {
+        for (int64_t i = 0; i < m; ++i) {
+            if (zero) {
+                B[i + j * ldb] = 0;
+            } else {
+                B[i + j * ldb] *= alpha;
+            }
+        }
+    }
+}
+
+// Blocked solve; B is m x n, and A is m x m (side 'L') or n x n (side 'R').
+inline void Rtrsm(char side, char uplo, char transa, char diag, int64_t m, int64_t n, const mpf_class &alpha, const mpf_class *A, int64_t lda, mpf_class *B, int64_t ldb, int64_t nb = Rtrsm_block_size) {
+    if (m <= 0 || n <= 0) {
+        return;
+    }
+    const bool left = Rgemm_packed_lsame(side, 'L');
+    const bool trans = !Rgemm_packed_lsame(transa, 'N');
+    const bool lower = Rgemm_packed_lsame(uplo, 'L') != trans;
+    const bool unit = Rgemm_packed_lsame(diag, 'U');
+    Rtrsm_scale(m, n, alpha, B, ldb);
+    if (alpha == 0) {
+        return;
+    }
+    // op(A)(i0:, j0:) as an operand of Rgemm_packed with transpose flag trans
+    auto opA = [&](int64_t i0, int64_t j0) { return trans ? &A[j0 + i0 * lda] : &A[i0 + j0 * lda]; };
+    const mpf_class minus_one = -1;
+    const int64_t order = left ? m : n;
+    const int64_t nblocks = (order + nb - 1) / nb;
+    // Left-lower and right-upper solves run forward, the other two backward.
+    const bool forward = left == lower;
+    for (int64_t s = 0; s < nblocks; ++s) {
+        const int64_t k = (forward ? s : nblocks - 1 - s) * nb;
+        const int64_t kb = std::min(nb, order - k);
+        const mpf_class *Akk = &A[k + k * lda];
+        if (left) {
+            Rtrsm_unblocked(true, lower, trans, unit, kb, n, Akk, lda, &B[k], ldb);
+            if (lower) {
+                Rgemm_packed(trans, false, m - k - kb, n, kb, minus_one, opA(k + kb, k), lda, &B[k], ldb, &B[k + kb], ldb);
+            } else {
+                Rgemm_packed(trans, false, k, n, kb, minus_one, opA(0, k), lda, &B[k], ldb, B, ldb);
+            }
+        } else {
+            Rtrsm_unblocked(false, lower, trans, unit, m, kb, Akk, lda, &B[k * ldb], ldb);
+            if (lower) {
+                Rgemm_packed(false, trans, m, k, kb, minus_one, &B[k * ldb], ldb, opA(k, 0), lda, B, ldb);
+            } else {
+                Rgemm_packed(false, trans, m, n - k - kb, kb, minus_one, &B[k * ldb], ldb, opA(k, k + kb), lda, &B[(k + kb) * ldb], ldb);
+            }
+        }
+    }
+}
+
+// cf. https://netlib.org/lapack/lawnspdf/lawn41.pdf p.120
+inline double flops_trsm(char side, int64_t m_i, int64_t n_i) {
+    double m = (double)m_i;
+    double n = (double)n_i;
+    double muls, adds;
+    if (Rgemm_packed_lsame(side, 'L')) {
+        muls = 0.5 * n * m * (m + 1.0);
+        adds = 0.5 * n * m * (m - 1.0);
+    } else {
+        muls = 0.5 * m * n * (n + 1.0);
+        adds = 0.5 * m * n * (n - 1.0);
+    }
+    return muls + adds;
+}
+
+// L1 norm of op(A) * X - alpha * B (side 'L') or X * op(A) - alpha * B
+// (side 'R'), with op(A) read through the triangle named by uplo and diag.
+inline mpf_class Rtrsm_residual(char side, char uplo, char transa, char diag, int64_t m, int64_t n, const mpf_class &alpha, const mpf_class *A, int64_t lda, const mpf_class *X, int64_t ldx, const mpf_class *B, int64_t ldb) {
+    const bool left = Rgemm_packed_lsame(side, 'L');
+    const bool trans = !Rgemm_packed_lsame(transa, 'N');
+    const bool upper = Rgemm_packed_lsame(uplo, 'U');
+    const bool unit = Rgemm_packed_lsame(diag, 'U');
+    // Stored triangle only, unit diagonal implied
+    auto a = [&](int64_t i, int64_t j) -> mpf_class {
+        int64_t r = trans ? j : i;
+        int64_t c = trans ? i : j;
+        if (r == c) {
+            return unit ? mpf_class(1) : A[r + c * lda];
+        }
+        if ((r < c) != upper) {
+            return mpf_class(0);
+        }
+        return A[r + c * lda];
+    };
+    const int64_t order = left ? m : n;
+    mpf_class norm = 0;
+    mpf_class r, temp;
+    for (int64_t j = 0; j < n; ++j) {
+        for (int64_t i = 0; i < m; ++i) {
+            r = alpha;
+            r *= B[i + j * ldb];
+            r = -r;
+            for (int64_t l = 0; l < order; ++l) {
+                if (left) {
+                    temp = a(i, l);
+                    temp *= X[l + j * ldx];
+                } else {
+                    temp = X[i + l * ldx];
+                    temp *= a(l, j);
+                }
+                r += temp;
+            }
+            norm += abs(r);
+        }
+    }
+    return norm;
+}
+
+// Runs Rtrsm on a small random system for all 16 side, uplo, transa and
+// diag combinations, with block size nb so that several diagonal blocks are
+// crossed, and returns the largest Rtrsm_residual.
+inline mpf_class Rtrsm_sweep(gmp_randclass &r, int prec, int64_t m = 11, int64_t n = 9, int64_t nb = 4) {
+    const char sides[] = {'L', 'R'};
+    const char uplos[] = {'L', 'U'};
+    const char transas[] = {'N', 'T'};
+    const char diags[] = {'N', 'U'};
+    mpf_class worst = 0;
+    for (char side : sides) {
+        const int64_t order = side == 'L' ? m : n;
+        // A full random matrix with a dominant diagonal: both triangles are
+        // well conditioned, and the unreferenced one must stay unread.
+        std::vector<mpf_class> A(order * order);
+        for (int64_t j = 0; j < order; ++j) {
+            for (int64_t i = 0; i < order; ++i) {
+                A[i + j * order] = r.get_f(prec);
+            }
+            A[j + j * order] += order;
+        }
+        std::vector<mpf_class> B(m * n), X(m * n);
+        for (char uplo : uplos) {
+            for (char transa : transas) {
+                for (char diag : diags) {
+                    const mpf_class alpha = r.get_f(prec);
+                    for (int64_t i = 0; i < m * n; ++i) {
+                        B[i] = r.get_f(prec);
+                        X[i] = B[i];
+                    }
+                    Rtrsm(side, uplo, transa, diag, m, n, alpha, A.data(), order, X.data(), m, nb);
+                    const mpf_class residual = Rtrsm_residual(side, uplo, transa, diag, m, n, alpha, A.data(), order, X.data(), m, B.data(), m);
+                    if (residual > worst) {
+                        worst = residual;
+                    }
+                }
+            }
+        }
+    }
+    return worst;
+}
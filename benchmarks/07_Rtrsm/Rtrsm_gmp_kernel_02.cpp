@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2026
+ *      Nakata, Maho
+ *      All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ */
+
+#include <iostream>
+#include <chrono>
+#include <cstdlib>
+
+#if defined USE_ORIGINAL_GMPXX
+#include <gmpxx.h>
+#else
+#include "gmpxx_mkII.h"
+#if !defined ___GMPXX_STRICT_COMPATIBILITY___
+using namespace gmpxx;
+#endif
+#endif
+
+#include "Rtrsm.hpp"
+
+#define MFLOPS 1e+6
+
+// Blocked solve: diagonal blocks with the unblocked solve, the rest of B
+// through the packed gemm tiles.
+void _Rtrsm(int64_t m, int64_t n, const mpf_class &alpha, const mpf_class *A, int64_t lda, mpf_class *B, int64_t ldb) {
+    Rtrsm('L', 'L', 'N', 'N', m, n, alpha, A, lda, B, ldb);
+}
+
+int main(int argc, char **argv) {
+    // Initialize random state
+    gmp_randclass r(gmp_randinit_default);
+    r.seed(42);
+
+    // Check command-line arguments
+    if (argc != 4) {
+        std::cerr << "Usage: " << argv[0] << " <rows m> <cols n> <precision>" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    int64_t M = std::atoll(argv[1]); // Order of A and rows of B
+    int64_t N = std::atoll(argv[2]); // Columns of B
+    int prec = std::atoi(argv[3]);   // Precision in bits
+    mpf_set_default_prec(prec);
+#if !defined USE_ORIGINAL_GMPXX
+    gmpxx::gmpxx_defaults::set_initial_default_prec(prec);
+#endif
+
+    // A (M x M) lower triangular, B (M x N) right-hand sides, X the solution
+    mpf_class *A = new mpf_class[M * M];
+    mpf_class *B = new mpf_class[M * N];
+    mpf_class *X = new mpf_class[M * N];
+
+    mpf_class alpha = r.get_f(prec);
+
+    // Diagonally dominant, so the solution stays well scaled
+    for (int64_t j = 0; j < M; ++j) {
+        for (int64_t i = j; i < M; ++i) {
+            A[i + j * M] = r.get_f(prec);
+        }
+        A[j + j * M] += M;
+    }
+    for (int64_t j = 0; j < N; ++j) {
+        for (int64_t i = 0; i < M; ++i) {
+            B[i + j * M] = r.get_f(prec);
+            X[i + j * M] = B[i + j * M];
+        }
+    }
+
+    // Perform _Rtrsm: X := alpha * inv(A) * X
+    auto start = std::chrono::high_resolution_clock::now();
+    _Rtrsm(M, N, alpha, A, M, X, M);
+    auto end = std::chrono::high_resolution_clock::now();
+
+    std::chrono::duration<double> elapsed = end - start;
+    double mflops = flops_trsm('L', M, N) / (elapsed.count() * MFLOPS);
+
+    // Output performance metrics
+    std::cout << "Elapsed time: " << elapsed.count() << " s" << std::endl;
+    std::cout << "MFLOPS: " << mflops << std::endl;
+
+    // L1 norm of A * X - alpha * B
+    mpf_class l1_norm = Rtrsm_residual('L', 'L', 'N', 'N', M, N, alpha, A, M, X, M, B, M);
+    std::cout << "L1 Norm of residual: ";
+    gmp_printf("%.4Fg\n", l1_norm.get_mpf_t());
+
+    // Verify correctness
+    mpf_class threshold = 1e-5;
+    if (l1_norm < threshold) {
+        std::cout << "Result OK" << std::endl;
+    } else {
+        std::cout << "Result NG" << std::endl;
+    }
+
+    // The timed run covers one case; check all 16 on a small system.
+    mpf_class sweep = Rtrsm_sweep(r, prec);
+    std::cout << "All cases L1 Norm: ";
+    gmp_printf("%.4Fg\n", sweep.get_mpf_t());
+    if (sweep < threshold) {
+        std::cout << "All cases OK" << std::endl;
+    } else {
+        std::cout << "All cases NG" << std::endl;
+    }
+
+    // Clean up
+    delete[] A;
+    delete[] B;
+    delete[] X;
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2026
+ *      Nakata, Maho
+ *      All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ */
+
+#pragma once
+
+// Synthetic sparse patterns and reference loops for the SpMV benchmark.
+//
+// Matrices are square, n x n, and stored as CSR arrays (row pointers,
+// column indices, values).  Two patterns are generated:
+//
+//   banded: row i holds columns i - w/2 .. i + w - 1 - w/2, clipped to the
+//           matrix, where w is the requested nonzeros per row;
+//   random: row i holds w distinct columns drawn from a fixed linear
+//           congruential generator, sorted.
+//
+// The banded pattern reads x almost sequentially; the random one scatters
+// the reads over the whole vector.  The patterns do not depend on the
+// precision or on the header being benchmarked, so all variants multiply
+// the same matrix.
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+enum class Rspmv_pattern { banded, random };
+
+// Returns false for an unknown pattern name.
+inline bool Rspmv_parse_pattern(const char *name, Rspmv_pattern &pattern) {
+    if (std::strcmp(name, "banded") == 0) {
+        pattern = Rspmv_pattern::banded;
+        return true;
+    }
+    if (std::strcmp(name, "random") == 0) {
+        pattern = Rspmv_pattern::random;
+        return true;
+    }
+    return false;
+}
+
+// Row pointers and column indices of the pattern; width is capped at n.
+inline void Rspmv_generate_pattern(Rspmv_pattern pattern, int64_t n, int64_t width, std::vector<int64_t> &rowptr, std::vector<int64_t> &colind) {
+    width = std::min(width, n);
+    rowptr.assign(n + 1, 0);
+    colind.clear();
+    colind.reserve(n * width);
+    uint64_t state = 88172645463325252ULL;
+    std::vector<int64_t> row;
+    for (int64_t i = 0; i < n; ++i) {
+        row.clear();
+        if (pattern == Rspmv_pattern::banded) {
+            int64_t first = std::clamp<int64_t>(i - width / 2, 0, n - width);
+            for (int64_t l = 0; l < width; ++l) {
+                row.push_back(first + l);
+            }
+        } else {
+            while ((int64_t)row.size() < width) {
+                state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+                int64_t j = (int64_t)((state >> 33) % (uint64_t)n);
+                if (std::find(row.begin(), row.end(), j) == row.end()) {
+                    row.push_back(j);
+                }
+            }
+            std::sort(row.begin(), row.end());
+        }
+        colind.insert(colind.end(), row.begin(), row.end());
+        rowptr[i + 1] = (int64_t)colind.size();
+    }
+}
+
+// CSR arrays of A^T, i.e. the CSC arrays of A.
+inline void Rspmv_transpose(int64_t n, const std::vector<int64_t> &rowptr, const std::vector<int64_t> &colind, const mpf_class *values, std::vector<int64_t> &rowptr_t, std::vector<int64_t> &colind_t, mpf_class *values_t) {
+    rowptr_t.assign(n + 1, 0);
+    colind_t.assign(colind.size(), 0);
+    for (int64_t j : colind) {
+        ++rowptr_t[j + 1];
+    }
+    for (int64_t j = 0; j < n; ++j) {
+        rowptr_t[j + 1] += rowptr_t[j];
+    }
+    std::vector<int64_t> next(rowptr_t.begin(), rowptr_t.end() - 1);
+    for (int64_t i = 0; i < n; ++i) {
+        for (int64_t k = rowptr[i]; k < rowptr[i + 1]; ++k) {
+            int64_t dst = next[colind[k]]++;
+            colind_t[dst] = i;
+            values_t[dst] = values[k];
+        }
+    }
+}
+
+// y := A * x, row by row.
+inline void Rspmv_csr(int64_t n, const int64_t *rowptr, const int64_t *colind, const mpf_class *values, const mpf_class *x, mpf_class *y) {
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic, 256)
+#endif
+    for (int64_t i = 0; i < n; ++i) {
+        mpf_class sum = 0;
+        for (int64_t k = rowptr[i]; k < rowptr[i + 1]; ++k) {
+            sum += values[k] * x[colind[k]];
+        }
+        y[i] = sum;
+    }
+}
+
+// y := A^T * x, scattering row i of A scaled by x[i].
+inline void Rspmv_csr_transposed(int64_t n, const int64_t *rowptr, const int64_t *colind, const mpf_class *values, const mpf_class *x, mpf_class *y) {
+    for (int64_t j = 0; j < n; ++j) {
+        y[j] = 0;
+    }
+    for (int64_t i = 0; i < n; ++i) {
+        for (int64_t k = rowptr[i]; k < rowptr[i + 1]; ++k) {
+            y[colind[k]] += values[k] * x[i];
+        }
+    }
+}
+
+// One multiply and one add per stored entry.
+inline double flops_spmv(int64_t nnz) { return 2.0 * (double)nnz; }
+
+// L1 norm of y - y_ref.
+inline mpf_class Rspmv_difference(int64_t n, const mpf_class *y, const mpf_class *y_ref) {
+    mpf_class l1_norm = 0;
+    for (int64_t i = 0; i < n; ++i) {
+        mpf_class diff = abs(y[i] - y_ref[i]);
+        l1_norm += diff;
+    }
+    return l1_norm;
+}
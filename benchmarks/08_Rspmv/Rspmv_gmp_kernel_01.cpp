@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2026
+ *      Nakata, Maho
+ *      All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ */
+
+#include <iostream>
+#include <chrono>
+#include <cstdlib>
+#include <vector>
+
+#if defined USE_ORIGINAL_GMPXX
+#include <gmpxx.h>
+#else
+#include "gmpxx_mkII.h"
+#if !defined ___GMPXX_STRICT_COMPATIBILITY___
+using namespace gmpxx;
+#endif
+#endif
+
+#include "Rspmv.hpp"
+
+#define MFLOPS 1e+6
+
+// Row-by-row loop over CSR arrays of mpf_class values.
+void _Rspmv(int64_t n, const int64_t *rowptr, const int64_t *colind, const mpf_class *values, const mpf_class *x, mpf_class *y) {
+    Rspmv_csr(n, rowptr, colind, values, x, y);
+}
+
+int main(int argc, char **argv) {
+    // Initialize random state
+    gmp_randclass r(gmp_randinit_default);
+    r.seed(42);
+
+    // Check command-line arguments
+    Rspmv_pattern pattern;
+    if (argc != 5 || !Rspmv_parse_pattern(argv[1], pattern)) {
+        std::cerr << "Usage: " << argv[0] << " <pattern banded|random> <rows n> <nonzeros per row> <precision>" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    int64_t N = std::atoll(argv[2]);     // Order of A
+    int64_t width = std::atoll(argv[3]); // Nonzeros per row
+    int prec = std::atoi(argv[4]);       // Precision in bits
+    mpf_set_default_prec(prec);
+#if !defined USE_ORIGINAL_GMPXX
+    gmpxx::gmpxx_defaults::set_initial_default_prec(prec);
+#endif
+
+    // Generate the pattern, the values of A, and x
+    std::vector<int64_t> rowptr, colind;
+    Rspmv_generate_pattern(pattern, N, width, rowptr, colind);
+    const int64_t nnz = rowptr[N];
+    mpf_class *values = new mpf_class[nnz];
+    mpf_class *x = new mpf_class[N];
+    mpf_class *y = new mpf_class[N];
+    mpf_class *y_ref = new mpf_class[N];
+    for (int64_t k = 0; k < nnz; ++k) {
+        values[k] = r.get_f(prec);
+    }
+    for (int64_t i = 0; i < N; ++i) {
+        x[i] = r.get_f(prec);
+    }
+
+    // Perform _Rspmv: y := A * x
+    auto start = std::chrono::high_resolution_clock::now();
+    _Rspmv(N, rowptr.data(), colind.data(), values, x, y);
+    auto end = std::chrono::high_resolution_clock::now();
+
+    // Perform reference computation
+    // (A^T)^T * x by scattering the transposed arrays
+    std::vector<int64_t> rowptr_t, colind_t;
+    mpf_class *values_t = new mpf_class[nnz];
+    Rspmv_transpose(N, rowptr, colind, values, rowptr_t, colind_t, values_t);
+    Rspmv_csr_transposed(N, rowptr_t.data(), colind_t.data(), values_t, x, y_ref);
+    delete[] values_t;
+
+    std::chrono::duration<double> elapsed = end - start;
+    double mflops = flops_spmv(nnz) / (elapsed.count() * MFLOPS);
+
+    // Output performance metrics
+    std::cout << "Elapsed time: " << elapsed.count() << " s" << std::endl;
+    std::cout << "MFLOPS: " << mflops << std::endl;
+
+    // L1 norm of y - y_ref
+    mpf_class l1_norm = Rspmv_difference(N, y, y_ref);
+    std::cout << "L1 Norm of difference: ";
+    gmp_printf("%.4Fg\n", l1_norm.get_mpf_t());
+
+    // Verify correctness
+    mpf_class threshold = 1e-5;
+    if (l1_norm < threshold) {
+        std::cout << "Result OK" << std::endl;
+    } else {
+        std::cout << "Result NG" << std::endl;
+    }
+
+    // Clean up
+    delete[] values;
+    delete[] x;
+    delete[] y;
+    delete[] y_ref;
+
+    return EXIT_SUCCESS;
+}
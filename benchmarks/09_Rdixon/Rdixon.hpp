@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2026
+ *      Nakata, Maho
+ *      All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ */
+
+#pragma once
+
+// Random integer systems and reference loops for the exact solve benchmark.
+//
+// A is n x n in column-major order and b has n entries.  Each entry is a
+// signed integer of at most `bits` bits drawn from gmp_randclass, so all
+// variants solve the same system for the same seed.  The diagonal gets
+// 2^bits added to it, which keeps A nonsingular without making it
+// triangular.
+
+#include <cstdint>
+#include <vector>
+
+inline void Rdixon_generate(gmp_randclass &r, int64_t n, unsigned long bits, std::vector<mpz_class> &A, std::vector<mpz_class> &b) {
+    mpz_class half;
+    mpz_ui_pow_ui(half.get_mpz_t(), 2, bits - 1);
+    A.resize(n * n);
+    b.resize(n);
+    for (int64_t j = 0; j < n; ++j) {
+        for (int64_t i = 0; i < n; ++i) {
+            A[i + j * n] = r.get_z_bits(bits) - half; // Column-major order
+        }
+        A[j + j * n] += 2 * half;
+    }
+    for (int64_t i = 0; i < n; ++i) {
+        b[i] = r.get_z_bits(bits) - half;
+    }
+}
+
+// Gaussian elimination over mpq_class with the first nonzero pivot.
+// A and b are overwritten; returns false if A is singular.
+inline bool Rgesv_rational(int64_t n, std::vector<mpq_class> &A, std::vector<mpq_class> &b) {
+    for (int64_t k = 0; k < n; ++k) {
+        int64_t p = k;
+        while (p < n && sgn(A[p + k * n]) == 0) {
+            ++p;
+        }
+        if (p == n) {
+            return false;
+        }
+        if (p != k) {
+            for (int64_t j = k; j < n; ++j) {
+                std::swap(A[k + j * n], A[p + j * n]);
+            }
+            std::swap(b[k], b[p]);
+        }
+        for (int64_t i = k + 1; i < n; ++i) {
+            mpq_class l = A[i + k * n] / A[k + k * n];
+            for (int64_t j = k + 1; j < n; ++j) {
+                A[i + j * n] -= l * A[k + j * n];
+            }
+            b[i] -= l * b[k];
+        }
+    }
+    for (int64_t i = n - 1; i >= 0; --i) {
+        for (int64_t j = i + 1; j < n; ++j) {
+            b[i] -= A[i + j * n] * b[j];
+        }
+        b[i] /= A[i + i * n];
+    }
+    return true;
+}
+
+// Number of rows i with (A x)_i != b_i, computed exactly.
+inline int64_t Rdixon_mismatches(int64_t n, const std::vector<mpz_class> &A, const std::vector<mpq_class> &x, const std::vector<mpz_class> &b) {
+    int64_t mismatches = 0;
+    for (int64_t i = 0; i < n; ++i) {
+        mpq_class sum = 0;
+        for (int64_t j = 0; j < n; ++j) {
+            sum += mpq_class(A[i + j * n]) * x[j];
+        }
+        if (sum != mpq_class(b[i])) {
+            ++mismatches;
+        }
+    }
+    return mismatches;
+}
+
+// Flops of an LU solve of order n, so the rates compare with 04_Rgetrf.
+inline double flops_gesv(int64_t n) {
+    double dn = static_cast<double>(n);
+    return (2.0 / 3.0) * dn * dn * dn + 2.0 * dn * dn;
+}
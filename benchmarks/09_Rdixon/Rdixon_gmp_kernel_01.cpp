@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2026
+ *      Nakata, Maho
+ *      All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ */
+
+#include <iostream>
+#include <chrono>
+#include <cstdlib>
+#include <vector>
+
+#if defined USE_ORIGINAL_GMPXX
+#include <gmpxx.h>
+#else
+#include "gmpxx_mkII.h"
+#if !defined ___GMPXX_STRICT_COMPATIBILITY___
+using namespace gmpxx;
+#endif
+#endif
+
+#include "Rdixon.hpp"
+
+#define MFLOPS 1e+6
+
+// Gaussian elimination over mpq_class.  The entries of the reduced matrix
+// grow to about n times the input size, and every update reduces a
+// fraction by a gcd.
+std::vector<mpq_class> _Rgesv_exact(int64_t n, const std::vector<mpz_class> &A, const std::vector<mpz_class> &b) {
+    std::vector<mpq_class> Aq(A.begin(), A.end());
+    std::vector<mpq_class> x(b.begin(), b.end());
+    if (!Rgesv_rational(n, Aq, x)) {
+        x.clear();
+    }
+    return x;
+}
+
+int main(int argc, char **argv) {
+    // Initialize random state
+    gmp_randclass r(gmp_randinit_default);
+    r.seed(42);
+
+    // Check command-line arguments
+    if (argc != 3) {
+        std::cerr << "Usage: " << argv[0] << " <matrix size n> <entry bits>" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    int64_t N = std::atoll(argv[1]);              // Order of A
+    unsigned long bits = std::strtoul(argv[2], nullptr, 10); // Bits per entry
+    if (N < 1 || bits < 2) {
+        std::cerr << "Matrix size must be positive and entries need at least 2 bits" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    // A (N x N) and b are kept for the exact check
+    std::vector<mpz_class> A;
+    std::vector<mpz_class> b;
+    Rdixon_generate(r, N, bits, A, b);
+
+    // Perform _Rgesv_exact
+    auto start = std::chrono::high_resolution_clock::now();
+    std::vector<mpq_class> x = _Rgesv_exact(N, A, b);
+    auto end = std::chrono::high_resolution_clock::now();
+
+    // MFLOPS counts the flops of an LU solve of the same order
+    std::chrono::duration<double> elapsed = end - start;
+    double mflops = flops_gesv(N) / (elapsed.count() * MFLOPS);
+
+    // Output performance metrics
+    std::cout << "Elapsed time: " << elapsed.count() << " s" << std::endl;
+    std::cout << "MFLOPS: " << mflops << std::endl;
+
+    // Verify correctness: A x == b holds exactly in every row
+    int64_t mismatches = Rdixon_mismatches(N, A, x, b);
+    std::cout << "Mismatched rows: " << mismatches << std::endl;
+    if (mismatches == 0) {
+        std::cout << "Result OK" << std::endl;
+    } else {
+        std::cout << "Result NG" << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,691 @@
+/*
+ * Copyright (c) 2026
+ *      Nakata, Maho
+ *      All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ */
+
+#pragma once
+
+// Symmetric eigenvalue problem A = Z * diag(w) * Z^T on column-major
+// mpf_class arrays, in the LAPACK storage: only the lower triangle of A is
+// read, and w is sorted ascending.
+//
+// Rsyev reduces A to tridiagonal form T = Q^T * A * Q and then runs the
+// implicit QL iteration on T.  The reduction follows xSYTRD:
+//
+//   Rlatrd reduces one panel of Rsytrd_block_size columns with
+//   matrix-vector products on the trailing matrix, and collects the
+//   changes the panel makes to it in an n x nb matrix W;
+//   Rsyr2k then applies them all at once, A := A - V * W^T - W * V^T.
+//
+// The rank-2k update holds half of the flops.  It runs on the packed tile
+// engine of 07_Rtrsm, with the tiles of the lower triangle scheduled over
+// OpenMP threads as in Rsyrk.  The other half is in the symmetric
+// matrix-vector products of Rlatrd, which are split over rows.
+//
+// When eigenvectors are wanted, Q is formed from the reflectors with the
+// compact WY routines of 06_Rgeqrf, and each QL sweep multiplies it by a
+// sequence of plane rotations.  The rotations of one sweep are generated
+// first and then applied to all rows of Z, which are independent, so this
+// step parallelizes over rows the way xLASR is used by xSTEQR.
+//
+// Rsyev_jacobi is the cyclic Jacobi method, kept as the unblocked
+// reference.
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "../06_Rgeqrf/Rgeqrf.hpp"
+#include "../07_Rtrsm/Rgemm_packed.hpp"
+
+inline constexpr int64_t Rsytrd_block_size = 32;
+
+// Sweeps of the QL iteration allowed per eigenvalue.
+inline constexpr int Rsteqr_max_iterations = 30;
+
+// 2^-prec for the working precision of x.
+inline mpf_class Rsyev_epsilon(const mpf_class &x) {
+    mpf_class eps = 1;
+    mpf_div_2exp(eps.get_mpf_t(), eps.get_mpf_t(), mpf_get_prec(x.get_mpf_t()));
+    return eps;
+}
+
+// y := A * x for the n x n symmetric matrix A stored in its lower triangle.
+inline void Rsymv_lower(int64_t n, const mpf_class *A, int64_t lda, const mpf_class *x, mpf_class *y) {
+#if defined(_OPENMP)
+#pragma omp parallel
+#endif
+    {
+        mpf_class temp;
+#if defined(_OPENMP)
+#pragma omp for schedule(static)
+#endif
+        for (int64_t i = 0; i < n; ++i) {
+            mpf_class &yi = y[i];
+            yi = 0;
+            for (int64_t j = 0; j <= i; ++j) {
+                temp = A[i + j * lda];
+                temp *= x[j];
+                yi += temp;
+            }
+            for (int64_t j = i + 1; j < n; ++j) {
+                temp = A[j + i * lda];
+                temp *= x[j];
+                yi += temp;
+            }
+        }
+    }
+}
+
+// w := tau * (w - 1/2 * tau * (w^T * v) * v), where w = A * v on entry.
+// This is the vector of the symmetric rank-2 update
+// (I - tau v v^T) A (I - tau v v^T) = A - v w^T - w v^T.
+inline void Rsytrd_correct(int64_t n, const mpf_class *v, const mpf_class &tau, mpf_class *w) {
+    mpf_class alpha = 0;
+    mpf_class temp;
+    for (int64_t i = 0; i < n; ++i) {
+        w[i] *= tau;
+        temp = w[i];
+        temp *= v[i];
+        alpha += temp;
+    }
+    alpha *= tau;
+    alpha /= -2;
+    for (int64_t i = 0; i < n; ++i) {
+        temp = alpha;
+        temp *= v[i];
+        w[i] += temp;
+    }
+}
+
+// Unblocked reduction of the n x n lower triangle of A to tridiagonal form.
+// d (n entries) and e (n - 1) receive the diagonal and subdiagonal of T, and
+// reflector i is stored in A(i+2:n, i) with its unit entry at row i + 1.
+inline void Rsytd2(int64_t n, mpf_class *A, int64_t lda, mpf_class *d, mpf_class *e, mpf_class *tau) {
+    if (n <= 0) {
+        return;
+    }
+    std::vector<mpf_class> w(n);
+    for (int64_t i = 0; i < n - 1; ++i) {
+        const int64_t m = n - i - 1;
+        mpf_class *v = &A[(i + 1) + i * lda];
+        mpf_class *A22 = &A[(i + 1) + (i + 1) * lda];
+        Rlarfg(m, v[0], &v[1], tau[i]);
+        e[i] = v[0];
+        if (tau[i] != 0) {
+            v[0] = 1;
+            Rsymv_lower(m, A22, lda, v, w.data());
+            Rsytrd_correct(m, v, tau[i], w.data());
+            // A22 := A22 - v * w^T - w * v^T, lower triangle
+#if defined(_OPENMP)
+#pragma omp parallel
+#endif
+            {
+                mpf_class temp;
+#if defined(_OPENMP)
+#pragma omp for schedule(static)
+#endif
+                for (int64_t j = 0; j < m; ++j) {
+                    for (int64_t l = j; l < m; ++l) {
+                        temp = v[l];
+                        temp *= w[j];
+                        A22[l + j * lda] -= temp;
+                        temp = w[l];
+                        temp *= v[j];
+                        A22[l + j * lda] -= temp;
+                    }
+                }
+            }
+            v[0] = e[i];
+        }
+        d[i] = A[i + i * lda];
+    }
+    d[n - 1] = A[(n - 1) + (n - 1) * lda];
+}
+
+// Reduces the first nb columns of the n x n lower triangle of A and returns
+// the n x nb matrix W with A(nb:n, nb:n) - V * W^T - W * V^T the trailing
+// matrix after the panel, where V is A(nb:n, 0:nb).  The subdiagonal of the
+// panel holds the unit entries of the reflectors on return; e receives the
+// values they replace.
+inline void Rlatrd(int64_t n, int64_t nb, mpf_class *A, int64_t lda, mpf_class *e, mpf_class *tau, mpf_class *W, int64_t ldw) {
+    std::vector<mpf_class> t1(nb), t2(nb);
+    for (int64_t i = 0; i < nb; ++i) {
+        // A(i:n, i) := A(i:n, i) - A(i:n, 0:i) * W(i, 0:i)^T - W(i:n, 0:i) * A(i, 0:i)^T
+        if (i > 0) {
+#if defined(_OPENMP)
+#pragma omp parallel
+#endif
+            {
+                mpf_class temp;
+#if defined(_OPENMP)
+#pragma omp for schedule(static)
+#endif
+                for (int64_t r = i; r < n; ++r) {
+                    for (int64_t l = 0; l < i; ++l) {
+                        temp = A[r + l * lda];
+                        temp *= W[i + l * ldw];
+                        A[r + i * lda] -= temp;
+                        temp = W[r + l * ldw];
+                        temp *= A[i + l * lda];
+                        A[r + i * lda] -= temp;
+                    }
+                }
+            }
+        }
+        if (i == n - 1) {
+            break;
+        }
+        const int64_t m = n - i - 1;
+        mpf_class *v = &A[(i + 1) + i * lda];
+        mpf_class *w = &W[(i + 1) + i * ldw];
+        Rlarfg(m, v[0], &v[1], tau[i]);
+        e[i] = v[0];
+        v[0] = 1;
+        // w := A(i+1:n, i+1:n) * v, then remove the panel's pending updates:
+        // w := w - A(i+1:n, 0:i) * (W(i+1:n, 0:i)^T * v)
+        //        - W(i+1:n, 0:i) * (A(i+1:n, 0:i)^T * v)
+        Rsymv_lower(m, &A[(i + 1) + (i + 1) * lda], lda, v, w);
+        if (i > 0) {
+#if defined(_OPENMP)
+#pragma omp parallel
+#endif
+            {
+                mpf_class temp;
+#if defined(_OPENMP)
+#pragma omp for schedule(static)
+#endif
+                for (int64_t l = 0; l < i; ++l) {
+                    t1[l] = 0;
+                    t2[l] = 0;
+                    for (int64_t r = 0; r < m; ++r) {
+                        temp = W[(i + 1 + r) + l * ldw];
+                        temp *= v[r];
+                        t1[l] += temp;
+                        temp = A[(i + 1 + r) + l * lda];
+                        temp *= v[r];
+                        t2[l] += temp;
+                    }
+                }
+#if defined(_OPENMP)
+#pragma omp for schedule(static)
+#endif
+                for (int64_t r = 0; r < m; ++r) {
+                    for (int64_t l = 0; l < i; ++l) {
+                        temp = A[(i + 1 + r) + l * lda];
+                        temp *= t1[l];
+                        w[r] -= temp;
+                        temp = W[(i + 1 + r) + l * ldw];
+                        temp *= t2[l];
+                        w[r] -= temp;
+                    }
+                }
+            }
+        }
+        Rsytrd_correct(m, v, tau[i], w);
+    }
+}
+
+// C := C + alpha * (V * W^T + W * V^T) on the n x n lower triangle of C,
+// with V and W n x k.
+inline void Rsyr2k_lower(int64_t n, int64_t k, const mpf_class &alpha, const mpf_class *V, int64_t ldv, const mpf_class *W, int64_t ldw, mpf_class *C, int64_t ldc) {
+    if (n <= 0 || k <= 0) {
+        return;
+    }
+    const int64_t nb = Rgemm_packed_nb;
+    const int64_t nt = (n + nb - 1) / nb;
+    // Tile (it, jt) of the triangle, in column order
+    std::vector<std::pair<int64_t, int64_t>> tiles;
+    tiles.reserve(nt * (nt + 1) / 2);
+    for (int64_t jt = 0; jt < nt; ++jt) {
+        for (int64_t it = jt; it < nt; ++it) {
+            tiles.emplace_back(it, jt);
+        }
+    }
+#if defined(_OPENMP)
+#pragma omp parallel
+#endif
+    {
+        Rgemm_packed_workspace work;
+#if defined(_OPENMP)
+#pragma omp for schedule(dynamic)
+#endif
+        for (int64_t t = 0; t < (int64_t)tiles.size(); ++t) {
+            const int64_t i = tiles[t].first * nb;
+            const int64_t j = tiles[t].second * nb;
+            const int64_t mb = std::min(nb, n - i);
+            const int64_t jb = std::min(nb, n - j);
+            const Rgemm_packed_shape shape = i == j ? Rgemm_packed_shape::lower : Rgemm_packed_shape::full;
+            mpf_class *Cij = &C[i + j * ldc];
+            Rgemm_tile(shape, false, true, mb, jb, k, alpha, &V[i], ldv, &W[j], ldw, Cij, ldc, work);
+            Rgemm_tile(shape, false, true, mb, jb, k, alpha, &W[i], ldw, &V[j], ldv, Cij, ldc, work);
+        }
+    }
+}
+
+// Blocked reduction of the n x n lower triangle of A to tridiagonal form,
+// with the same output as Rsytd2.  nb <= 1 selects Rsytd2 for the whole
+// matrix.
+inline void Rsytrd(int64_t n, mpf_class *A, int64_t lda, mpf_class *d, mpf_class *e, mpf_class *tau, int64_t nb = Rsytrd_block_size) {
+    int64_t i = 0;
+    if (nb > 1) {
+        std::vector<mpf_class> W(n * nb);
+        const mpf_class minus_one = -1;
+        for (; n - i > nb; i += nb) {
+            const int64_t ldw = n - i;
+            Rlatrd(n - i, nb, &A[i + i * lda], lda, &e[i], &tau[i], W.data(), ldw);
+            Rsyr2k_lower(n - i - nb, nb, minus_one, &A[(i + nb) + i * lda], lda, &W[nb], ldw, &A[(i + nb) + (i + nb) * lda], lda);
+            for (int64_t j = i; j < i + nb; ++j) {
+                A[(j + 1) + j * lda] = e[j];
+                d[j] = A[j + j * lda];
+            }
+        }
+    }
+    Rsytd2(n - i, &A[i + i * lda], lda, &d[i], &e[i], &tau[i]);
+}
+
+// Z := Q, the n x n product of the reflectors left in A by Rsytrd.
+inline void Rorgtr(int64_t n, const mpf_class *A, int64_t lda, const mpf_class *tau, mpf_class *Z, int64_t ldz) {
+    for (int64_t j = 0; j < n; ++j) {
+        for (int64_t i = 0; i < n; ++i) {
+            Z[i + j * ldz] = i == j ? 1 : 0;
+        }
+    }
+    if (n > 1) {
+        Rormqr(false, n - 1, n - 1, n - 1, &A[1], lda, tau, &Z[1 + ldz], ldz);
+    }
+}
+
+// A plane rotation of columns (i, i + 1): for each row,
+// (z_i, z_i+1) := (c z_i - s z_i+1, s z_i + c z_i+1).
+struct Rsteqr_rotation {
+    int64_t i;
+    mpf_class c, s;
+};
+
+// Applies the rotations in order to the n rows of Z.  Each row is
+// independent, so the rows are split over threads.
+inline void Rlasr_rows(int64_t n, const std::vector<Rsteqr_rotation> &rotations, mpf_class *Z, int64_t ldz) {
+    if (rotations.empty()) {
+        return;
+    }
+#if defined(_OPENMP)
+#pragma omp parallel
+#endif
+    {
+        mpf_class f, temp, templ;
+#if defined(_OPENMP)
+#pragma omp for schedule(static)
+#endif
+        for (int64_t k = 0; k < n; ++k) {
+            for (const Rsteqr_rotation &g : rotations) {
+                mpf_class &zi = Z[k + g.i * ldz];
+                mpf_class &zj = Z[k + (g.i + 1) * ldz];
+                f = zj;
+                temp = g.s;
+                temp *= zi;
+                templ = g.c;
+                templ *= f;
+                zj = temp;
+                zj += templ;
+                zi *= g.c;
+                temp = g.s;
+                temp *= f;
+                zi -= temp;
+            }
+        }
+    }
+}
+
+// Implicit QL iteration with Wilkinson shifts on the symmetric tridiagonal
+// matrix with diagonal d (n entries) and subdiagonal e (n - 1 entries).  d
+// receives the eigenvalues in ascending order and e is destroyed.  If Z is
+// not null, its n columns are multiplied by the eigenvectors of T; starting
+// from Q of Rsytrd, they become the eigenvectors of A.  Returns 0, or l + 1
+// when eigenvalue l did not converge.
+inline int64_t Rsteqr(int64_t n, mpf_class *d, mpf_class *e, mpf_class *Z, int64_t ldz) {
+    if (n <= 0) {
+        return 0;
+    }
+    const mpf_class eps = Rsyev_epsilon(d[0]);
+    std::vector<mpf_class> sub(e, e + n - 1);
+    sub.emplace_back(0);
+    std::vector<Rsteqr_rotation> rotations;
+    mpf_class b, c, f, g, p, r, s, temp;
+    for (int64_t l = 0; l < n; ++l) {
+        int iterations = 0;
+        for (;;) {
+            int64_t m = l;
+            for (; m < n - 1; ++m) {
+                temp = abs(d[m]);
+                temp += abs(d[m + 1]);
+                temp *= eps;
+                if (abs(sub[m]) <= temp) {
+                    break;
+                }
+            }
+            if (m == l) {
+                break;
+            }
+            if (++iterations > Rsteqr_max_iterations) {
+                return l + 1;
+            }
+            // Shift from the leading 2 x 2 block
+            g = d[l + 1];
+            g -= d[l];
+            g /= 2 * sub[l];
+            r = sqrt(g * g + 1);
+            g += g >= 0 ? r : mpf_class(-r);
+            g = sub[l] / g;
+            g += d[m];
+            g -= d[l];
+            s = 1;
+            c = 1;
+            p = 0;
+            rotations.clear();
+            bool deflated = false;
+            for (int64_t i = m - 1; i >= l; --i) {
+                f = s;
+                f *= sub[i];
+                b = c;
+                b *= sub[i];
+                r = sqrt(f * f + g * g);
+                sub[i + 1] = r;
+                if (r == 0) {
+                    // Split at i + 1: undo the shift there and restart
+                    d[i + 1] -= p;
+                    sub[m] = 0;
+                    deflated = true;
+                    break;
+                }
+                s = f / r;
+                c = g / r;
+                g = d[i + 1];
+                g -= p;
+                r = d[i];
+                r -= g;
+                r *= s;
+                temp = 2 * c;
+                temp *= b;
+                r += temp;
+                p = s;
+                p *= r;
+                d[i + 1] = g;
+                d[i + 1] += p;
+                g = c;
+                g *= r;
+                g -= b;
+                if (Z != nullptr) {
+                    rotations.push_back({i, c, s});
+                }
+            }
+            if (Z != nullptr) {
+                Rlasr_rows(n, rotations, Z, ldz);
+            }
+            if (!deflated) {
+                d[l] -= p;
+                sub[l] = g;
+                sub[m] = 0;
+            }
+        }
+    }
+    // Selection sort, which moves each eigenvector once
+    for (int64_t i = 0; i < n - 1; ++i) {
+        int64_t k = i;
+        for (int64_t j = i + 1; j < n; ++j) {
+            if (d[j] < d[k]) {
+                k = j;
+            }
+        }
+        if (k != i) {
+            std::swap(d[i], d[k]);
+            if (Z != nullptr) {
+                for (int64_t row = 0; row < n; ++row) {
+                    std::swap(Z[row + i * ldz], Z[row + k * ldz]);
+                }
+            }
+        }
+    }
+    return 0;
+}
+
+// Eigenvalues w (ascending) of the n x n symmetric matrix A, stored in its
+// lower triangle, and for jobz 'V' the orthonormal eigenvectors, which
+// overwrite A.  For jobz 'N' the lower triangle of A is destroyed.
+// Returns 0, or the Rsteqr failure index.  nb is the Rsytrd block size.
+inline int64_t Rsyev(char jobz, int64_t n, mpf_class *A, int64_t lda, mpf_class *w, int64_t nb = Rsytrd_block_size) {
+    if (n <= 0) {
+        return 0;
+    }
+    const bool wantz = Rgemm_packed_lsame(jobz, 'V');
+    std::vector<mpf_class> e(n), tau(n);
+    Rsytrd(n, A, lda, w, e.data(), tau.data(), nb);
+    if (!wantz) {
+        return Rsteqr(n, w, e.data(), nullptr, 0);
+    }
+    std::vector<mpf_class> Z(n * n);
+    Rorgtr(n, A, lda, tau.data(), Z.data(), n);
+    const int64_t info = Rsteqr(n, w, e.data(), Z.data(), n);
+    for (int64_t j = 0; j < n; ++j) {
+        for (int64_t i = 0; i < n; ++i) {
+            A[i + j * lda] = Z[i + j * n];
+        }
+    }
+    return info;
+}
+
+// Cyclic Jacobi method with the same interface as Rsyev.  Each sweep
+// annihilates every off-diagonal entry once with a plane rotation, which
+// costs O(n) per entry on both triangles of A and on the eigenvectors.  The
+// sweeps stop when the off-diagonal Frobenius norm falls below
+// n * 2^-prec times that of A.  Returns 0, or 1 without convergence.
+inline int64_t Rsyev_jacobi(char jobz, int64_t n, mpf_class *A, int64_t lda, mpf_class *w, int max_sweeps = 100) {
+    if (n <= 0) {
+        return 0;
+    }
+    const bool wantz = Rgemm_packed_lsame(jobz, 'V');
+    std::vector<mpf_class> V(wantz ? n * n : 0);
+    for (int64_t j = 0; wantz && j < n; ++j) {
+        V[j + j * n] = 1;
+    }
+    mpf_class frob = 0, off, temp;
+    for (int64_t j = 0; j < n; ++j) {
+        for (int64_t i = j; i < n; ++i) {
+            A[j + i * lda] = A[i + j * lda];
+            temp = A[i + j * lda];
+            temp *= temp;
+            frob += i == j ? temp : mpf_class(2 * temp);
+        }
+    }
+    mpf_class tol = Rsyev_epsilon(A[0]);
+    tol *= n;
+    tol *= tol;
+    tol *= frob;
+    mpf_class apq, theta, t, c, s, rho, g, h;
+    int64_t info = 1;
+    for (int sweep = 0; sweep < max_sweeps; ++sweep) {
+        off = 0;
+        for (int64_t q = 1; q < n; ++q) {
+            for (int64_t p = 0; p < q; ++p) {
+                temp = A[p + q * lda];
+                temp *= temp;
+                off += 2 * temp;
+            }
+        }
+        if (off <= tol) {
+            info = 0;
+            break;
+        }
+        for (int64_t p = 0; p < n - 1; ++p) {
+            for (int64_t q = p + 1; q < n; ++q) {
+                apq = A[p + q * lda];
+                if (apq == 0) {
+                    continue;
+                }
+                // t = tan of the rotation angle, the smaller root of
+                // t^2 + 2 theta t - 1 = 0
+                theta = A[q + q * lda];
+                theta -= A[p + p * lda];
+                theta /= 2 * apq;
+                t = sqrt(theta * theta + 1);
+                t += abs(theta);
+                t = 1 / t;
+                if (theta < 0) {
+                    t = -t;
+                }
+                c = 1 / sqrt(t * t + 1);
+                s = t;
+                s *= c;
+                rho = s / (1 + c);
+                temp = t;
+                temp *= apq;
+                A[p + p * lda] -= temp;
+                A[q + q * lda] += temp;
+                A[p + q * lda] = 0;
+                A[q + p * lda] = 0;
+                for (int64_t r = 0; r < n; ++r) {
+                    if (r == p || r == q) {
+                        continue;
+                    }
+                    g = A[r + p * lda];
+                    h = A[r + q * lda];
+                    temp = g;
+                    temp *= rho;
+                    temp += h;
+                    temp *= s;
+                    A[r + p * lda] = g;
+                    A[r + p * lda] -= temp;
+                    A[p + r * lda] = A[r + p * lda];
+                    temp = h;
+                    temp *= rho;
+                    temp = g - temp;
+                    temp *= s;
+                    A[r + q * lda] = h;
+                    A[r + q * lda] += temp;
+                    A[q + r * lda] = A[r + q * lda];
+                }
+                for (int64_t r = 0; wantz && r < n; ++r) {
+                    g = V[r + p * n];
+                    h = V[r + q * n];
+                    temp = g;
+                    temp *= rho;
+                    temp += h;
+                    temp *= s;
+                    V[r + p * n] = g;
+                    V[r + p * n] -= temp;
+                    temp = h;
+                    temp *= rho;
+                    temp = g - temp;
+                    temp *= s;
+                    V[r + q * n] = h;
+                    V[r + q * n] += temp;
+                }
+            }
+        }
+    }
+    for (int64_t i = 0; i < n; ++i) {
+        w[i] = A[i + i * lda];
+    }
+    // Same ordering as Rsteqr
+    for (int64_t i = 0; i < n - 1; ++i) {
+        int64_t k = i;
+        for (int64_t j = i + 1; j < n; ++j) {
+            if (w[j] < w[k]) {
+                k = j;
+            }
+        }
+        if (k != i) {
+            std::swap(w[i], w[k]);
+            for (int64_t row = 0; wantz && row < n; ++row) {
+                std::swap(V[row + i * n], V[row + k * n]);
+            }
+        }
+    }
+    for (int64_t j = 0; wantz && j < n; ++j) {
+        for (int64_t i = 0; i < n; ++i) {
+            A[i + j * lda] = V[i + j * n];
+        }
+    }
+    return info;
+}
+
+// cf. G. H. Golub and C. F. Van Loan, Matrix Computations, 4th ed., 8.3.
+// The symmetric QR algorithm costs about 4/3 n^3 flops for the eigenvalues
+// and 9 n^3 with the eigenvectors; the Jacobi kernel is rated on the same
+// counts.
+inline double flops_syev(bool wantz, int64_t n_i) {
+    double n = (double)n_i;
+    return wantz ? 9.0 * n * n * n : 4.0 / 3.0 * n * n * n;
+}
+
+// Checks the eigendecomposition of the symmetric matrix A (lower triangle).
+// With eigenvectors Z it returns the L1 norm of A * Z - Z * diag(w) plus that
+// of Z^T * Z - I.  Without them it returns |trace(A) - sum w_i| +
+// |trace(A^2) - sum w_i^2|, which vanish for the exact eigenvalues.
+inline mpf_class Rsyev_residual(bool wantz, int64_t n, const mpf_class *A, int64_t lda, const mpf_class *w, const mpf_class *Z, int64_t ldz) {
+    mpf_class norm = 0;
+    mpf_class sum, temp;
+    if (!wantz) {
+        mpf_class trace = 0, trace2 = 0;
+        for (int64_t j = 0; j < n; ++j) {
+            for (int64_t i = j; i < n; ++i) {
+                temp = A[i + j * lda];
+                temp *= temp;
+                trace2 += i == j ? temp : mpf_class(2 * temp);
+            }
+            trace += A[j + j * lda];
+            trace -= w[j];
+            temp = w[j];
+            temp *= w[j];
+            trace2 -= temp;
+        }
+        norm = abs(trace);
+        norm += abs(trace2);
+        return norm;
+    }
+    for (int64_t j = 0; j < n; ++j) {
+        for (int64_t i = 0; i < n; ++i) {
+            sum = w[j];
+            sum *= Z[i + j * ldz];
+            sum = -sum;
+            for (int64_t l = 0; l < n; ++l) {
+                temp = i >= l ? A[i + l * lda] : A[l + i * lda];
+                temp *= Z[l + j * ldz];
+                sum += temp;
+            }
+            norm += abs(sum);
+            sum = i == j ? -1 : 0;
+            for (int64_t l = 0; l < n; ++l) {
+                temp = Z[l + i * ldz];
+                temp *= Z[l + j * ldz];
+                sum += temp;
+            }
+            norm += abs(sum);
+        }
+    }
+    return norm;
+}
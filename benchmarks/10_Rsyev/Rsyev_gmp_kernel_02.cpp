@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2026
+ *      Nakata, Maho
+ *      All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ */
+
+#include <iostream>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#if defined USE_ORIGINAL_GMPXX
+#include <gmpxx.h>
+#else
+#include "gmpxx_mkII.h"
+#if !defined ___GMPXX_STRICT_COMPATIBILITY___
+using namespace gmpxx;
+#endif
+#endif
+
+#include "Rsyev.hpp"
+
+#define MFLOPS 1e+6
+
+// Unblocked tridiagonal reduction (Rsytd2) and implicit QL iteration.
+int64_t _Rsyev(char jobz, int64_t n, mpf_class *A, int64_t lda, mpf_class *w) {
+    return Rsyev(jobz, n, A, lda, w, 1);
+}
+
+int main(int argc, char **argv) {
+    // Initialize random state
+    gmp_randclass r(gmp_randinit_default);
+    r.seed(42);
+
+    // Check command-line arguments
+    if (argc != 4 || (std::strcmp(argv[1], "N") != 0 && std::strcmp(argv[1], "V") != 0)) {
+        std::cerr << "Usage: " << argv[0] << " <jobz N|V> <matrix size n> <precision>" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    char jobz = argv[1][0];         // 'V' also computes eigenvectors
+    bool wantz = jobz == 'V';
+    int64_t N = std::atoll(argv[2]); // Order of A
+    int prec = std::atoi(argv[3]);   // Precision in bits
+    mpf_set_default_prec(prec);
+#if !defined USE_ORIGINAL_GMPXX
+    gmpxx::gmpxx_defaults::set_initial_default_prec(prec);
+#endif
+
+    // A (N x N, symmetric) is kept for the residual; Z is overwritten
+    mpf_class *A = new mpf_class[N * N];
+    mpf_class *Z = new mpf_class[N * N];
+    mpf_class *w = new mpf_class[N];
+
+    for (int64_t j = 0; j < N; ++j) {
+        for (int64_t i = j; i < N; ++i) {
+            A[i + j * N] = r.get_f(prec); // Column-major order
+            A[j + i * N] = A[i + j * N];
+        }
+    }
+    for (int64_t k = 0; k < N * N; ++k) {
+        Z[k] = A[k];
+    }
+
+    // Perform _Rsyev
+    auto start = std::chrono::high_resolution_clock::now();
+    int64_t info = _Rsyev(jobz, N, Z, N, w);
+    auto end = std::chrono::high_resolution_clock::now();
+
+    std::chrono::duration<double> elapsed = end - start;
+    double mflops = flops_syev(wantz, N) / (elapsed.count() * MFLOPS);
+
+    // Output performance metrics
+    std::cout << "Elapsed time: " << elapsed.count() << " s" << std::endl;
+    std::cout << "MFLOPS: " << mflops << std::endl;
+
+    // L1 norm of A Z - Z diag(w) and Z^T Z - I, or the trace identities
+    mpf_class l1_norm = Rsyev_residual(wantz, N, A, N, w, Z, N);
+    std::cout << "L1 Norm of residual: ";
+    gmp_printf("%.4Fg\n", l1_norm.get_mpf_t());
+
+    // Verify correctness
+    mpf_class threshold = 1e-5;
+    if (info == 0 && l1_norm < threshold) {
+        std::cout << "Result OK" << std::endl;
+    } else {
+        std::cout << "Result NG" << std::endl;
+    }
+
+    // Clean up
+    delete[] A;
+    delete[] Z;
+    delete[] w;
+
+    return EXIT_SUCCESS;
+}
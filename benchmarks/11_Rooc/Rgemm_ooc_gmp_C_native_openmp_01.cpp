@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2026
+ *      Nakata, Maho
+ *      All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ */
+
+#include <iostream>
+#include <chrono>
+#include <cstdlib>
+#include <string>
+#include <gmp.h>
+
+#include "gmpxx_mkII.h"
+using namespace gmpxx;
+
+#include "Rtiled.hpp"
+
+#define MFLOPS 1e+6
+
+#include <omp.h>
+
+// C := alpha * A * B with A, B, and C in scratch files, each with at most
+// `resident tiles` tiles mapped at once; the block kernels spread the
+// columns of each tile over OpenMP threads
+
+int main(int argc, char **argv) {
+    if (argc != 5) {
+        std::cerr << "Usage: " << argv[0] << " <matrix size n> <tile size> <resident tiles> <precision>" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    int64_t n = std::atoll(argv[1]);        // Order of A, B, and C
+    int64_t tile = std::atoll(argv[2]);     // Tile size
+    int64_t capacity = std::atoll(argv[3]); // Tiles mapped at once per matrix
+    int prec = std::atoi(argv[4]);          // Precision in bits
+    mpf_set_default_prec(prec);
+    gmpxx::gmpxx_defaults::set_initial_default_prec(prec);
+
+    // The files are unlinked at once; the open descriptors keep them alive
+    const std::string path_A = Rtiled_scratch_path("Rgemm_ooc_A");
+    const std::string path_B = Rtiled_scratch_path("Rgemm_ooc_B");
+    const std::string path_C = Rtiled_scratch_path("Rgemm_ooc_C");
+    Rtiled_file A(path_A, n, n, tile, prec, capacity);
+    Rtiled_file B(path_B, n, n, tile, prec, capacity);
+    Rtiled_file C(path_C, n, n, tile, prec, capacity);
+    ::unlink(path_A.c_str());
+    ::unlink(path_B.c_str());
+    ::unlink(path_C.c_str());
+    Rtiled_fill_random(A, 1);
+    Rtiled_fill_random(B, 2);
+
+    mpf_t alpha, beta;
+    mpf_init2(alpha, prec);
+    mpf_init2(beta, prec);
+    mpf_set_d(alpha, 0.75);
+
+    // Perform C := alpha * A * B
+    auto start = std::chrono::high_resolution_clock::now();
+    Rgemm_tiled(alpha, A, B, beta, C);
+    auto end = std::chrono::high_resolution_clock::now();
+
+    std::chrono::duration<double> elapsed = end - start;
+    double mflops = flops_gemm_tiled(n, n, n) / (elapsed.count() * MFLOPS);
+
+    // Output performance metrics
+    std::cout << "Elapsed time: " << elapsed.count() << " s" << std::endl;
+    std::cout << "MFLOPS: " << mflops << std::endl;
+    std::cout << "Tile maps: " << A.maps() + B.maps() + C.maps() << " (peak " << A.peak_mapped() + B.peak_mapped() + C.peak_mapped() << " tiles)" << std::endl;
+
+    // L1 norm of C * x - alpha * A * (B * x) for a random x
+    gmp_randstate_t state;
+    gmp_randinit_default(state);
+    gmp_randseed_ui(state, 42);
+    mpf_t *x = new mpf_t[n];
+    for (int64_t i = 0; i < n; ++i) {
+        mpf_init2(x[i], prec);
+        mpf_urandomb(x[i], state, prec);
+    }
+    mpf_t l1_norm;
+    mpf_init2(l1_norm, prec);
+    Rgemm_tiled_residual(alpha, A, B, C, x, l1_norm);
+    std::cout << "L1 Norm of residual: ";
+    gmp_printf("%.4Fg\n", l1_norm);
+
+    // Verify correctness
+    if (mpf_cmp_d(l1_norm, 1e-5) < 0) {
+        std::cout << "Result OK" << std::endl;
+    } else {
+        std::cout << "Result NG" << std::endl;
+    }
+
+    // Clean up
+    for (int64_t i = 0; i < n; ++i) {
+        mpf_clear(x[i]);
+    }
+    delete[] x;
+    mpf_clear(l1_norm);
+    mpf_clear(alpha);
+    mpf_clear(beta);
+    gmp_randclear(state);
+    return EXIT_SUCCESS;
+}
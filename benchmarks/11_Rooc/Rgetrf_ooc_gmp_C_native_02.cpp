@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2026
+ *      Nakata, Maho
+ *      All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ */
+
+#include <iostream>
+#include <chrono>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <gmp.h>
+
+#include "gmpxx_mkII.h"
+using namespace gmpxx;
+
+#include "Rtiled.hpp"
+
+#define MFLOPS 1e+6
+
+// A = P * L * U in place with A in a scratch file with at most
+// `resident tiles` tiles mapped at once.  The panel stays mapped while the
+// tile columns right of it stream past, so 2 * n / (tile size) tiles
+// avoid rereading a column
+
+int main(int argc, char **argv) {
+    if (argc != 5) {
+        std::cerr << "Usage: " << argv[0] << " <matrix size n> <tile size> <resident tiles> <precision>" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    int64_t n = std::atoll(argv[1]);        // Order of A
+    int64_t tile = std::atoll(argv[2]);     // Tile size
+    int64_t capacity = std::atoll(argv[3]); // Tiles mapped at once
+    int prec = std::atoi(argv[4]);          // Precision in bits
+    mpf_set_default_prec(prec);
+    gmpxx::gmpxx_defaults::set_initial_default_prec(prec);
+
+    // The file is unlinked at once; the open descriptor keeps it alive
+    const std::string path_A = Rtiled_scratch_path("Rgetrf_ooc_A");
+    Rtiled_file A(path_A, n, n, tile, prec, capacity);
+    ::unlink(path_A.c_str());
+    Rtiled_fill_random(A, 1);
+
+    std::vector<int64_t> ipiv;
+
+    // Perform A = P * L * U
+    auto start = std::chrono::high_resolution_clock::now();
+    int64_t info = Rgetrf_tiled(A, ipiv);
+    auto end = std::chrono::high_resolution_clock::now();
+
+    std::chrono::duration<double> elapsed = end - start;
+    double mflops = flops_getrf_tiled(n) / (elapsed.count() * MFLOPS);
+
+    // Output performance metrics
+    std::cout << "Elapsed time: " << elapsed.count() << " s" << std::endl;
+    std::cout << "MFLOPS: " << mflops << std::endl;
+    std::cout << "Tile maps: " << A.maps() << " (peak " << A.peak_mapped() << " tiles)" << std::endl;
+    if (info != 0) {
+        std::cout << "Zero pivot at " << info << std::endl;
+    }
+
+    // L1 norm of P^T * A * x - L * (U * x) for a random x
+    gmp_randstate_t state;
+    gmp_randinit_default(state);
+    gmp_randseed_ui(state, 42);
+    mpf_t *x = new mpf_t[n];
+    for (int64_t i = 0; i < n; ++i) {
+        mpf_init2(x[i], prec);
+        mpf_urandomb(x[i], state, prec);
+    }
+    mpf_t l1_norm;
+    mpf_init2(l1_norm, prec);
+    Rgetrf_tiled_residual(A, ipiv, 1, x, l1_norm);
+    std::cout << "L1 Norm of residual: ";
+    gmp_printf("%.4Fg\n", l1_norm);
+
+    // Verify correctness
+    if (info == 0 && mpf_cmp_d(l1_norm, 1e-5) < 0) {
+        std::cout << "Result OK" << std::endl;
+    } else {
+        std::cout << "Result NG" << std::endl;
+    }
+
+    // Clean up
+    for (int64_t i = 0; i < n; ++i) {
+        mpf_clear(x[i]);
+    }
+    delete[] x;
+    mpf_clear(l1_norm);
+    gmp_randclear(state);
+    return EXIT_SUCCESS;
+}
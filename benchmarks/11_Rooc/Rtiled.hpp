@@ -0,0 +1,737 @@
+/*
+ * Copyright (c) 2026
+ *      Nakata, Maho
+ *      All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ */
+
+#pragma once
+
+// Out-of-core tiled matrices in a memory-mapped file, and tiled gemm and LU
+// drivers that run on any tile store.
+//
+// File layout, version 1.  All integers are native-endian uint64_t.  Every
+// region starts at a multiple of Rtiled_alignment bytes, so each tile can
+// be mapped on its own with any page size up to 64 KiB.
+//
+//   header  magic "GMPXXTIL", version, rows, cols, tile size T, precision
+//           in bits, limbs per entry, bytes per tile
+//   tiles   tile (it, jt) at offset Rtiled_alignment
+//           + (it + jt * mt) * tile_bytes, in column-major tile order
+//
+// A tile holds T x T entries in column-major order, including the tiles
+// on the matrix edges.  An entry is a record of mp_limb_t: _mp_size, then
+// _mp_exp, then the limbs of an mpf_t at the file precision.  A
+// zero-filled record is the value 0, so a new file is a zero matrix.
+//
+// Rtiled_file maps a tile when it is acquired.  It points an array of mpf_t
+// headers at the tile's records, so the tile is a column-major mpf_t block
+// with leading dimension T.  The limbs are used in place: mpf functions
+// never reallocate, so results land directly in the mapping.  A released
+// tile stays mapped until more than `capacity` tiles are mapped.  Then the
+// least recently used unpinned tile writes its sizes and exponents back and
+// is unmapped.  This bounds the working set.  prefetch() asks the kernel,
+// through posix_fadvise, to read a tile ahead, so the I/O overlaps the
+// arithmetic on the current tiles.
+//
+// Rtiled_memory has the same interface and keeps every tile in memory.  The
+// drivers and the block kernels below are the same for both stores.  The
+// tile products run on the packed tile engine of ../07_Rtrsm, through its
+// mpf_t entry.
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <gmp.h>
+
+#include "../07_Rtrsm/Rgemm_packed.hpp"
+
+inline constexpr uint64_t Rtiled_alignment = 65536;
+inline constexpr char Rtiled_magic[8] = {'G', 'M', 'P', 'X', 'X', 'T', 'I', 'L'};
+inline constexpr uint64_t Rtiled_version = 1;
+
+struct Rtiled_header {
+    char magic[8];
+    uint64_t version;
+    uint64_t rows;
+    uint64_t cols;
+    uint64_t tile;
+    uint64_t precision;
+    uint64_t entry_limbs;
+    uint64_t tile_bytes;
+};
+
+// _mp_prec of an mpf_t initialized with mpf_init2(prec); it owns one more
+// limb than that.
+inline int64_t Rtiled_prec_limbs(mp_bitcnt_t prec) { return (int64_t)((prec + 2 * GMP_NUMB_BITS - 1) / GMP_NUMB_BITS); }
+
+// Tile counts and edge sizes shared by the stores.
+class Rtiled_geometry {
+  public:
+    int64_t rows() const { return rows_; }
+    int64_t cols() const { return cols_; }
+    int64_t tile() const { return tile_; }
+    int64_t mt() const { return mt_; }
+    int64_t nt() const { return nt_; }
+    int64_t tile_rows(int64_t it) const { return std::min(tile_, rows_ - it * tile_); }
+    int64_t tile_cols(int64_t jt) const { return std::min(tile_, cols_ - jt * tile_); }
+    mp_bitcnt_t precision() const { return precision_; }
+
+  protected:
+    void set_geometry(int64_t rows, int64_t cols, int64_t tile, mp_bitcnt_t prec) {
+        if (rows < 0 || cols < 0 || tile <= 0 || prec == 0) {
+            throw std::invalid_argument("Rtiled: bad matrix or tile size");
+        }
+        rows_ = rows;
+        cols_ = cols;
+        tile_ = tile;
+        mt_ = (rows + tile - 1) / tile;
+        nt_ = (cols + tile - 1) / tile;
+        precision_ = prec;
+    }
+
+    int64_t rows_ = 0, cols_ = 0, tile_ = 1, mt_ = 0, nt_ = 0;
+    mp_bitcnt_t precision_ = 0;
+};
+
+// All tiles in memory, each entry initialized with mpf_init2.
+class Rtiled_memory : public Rtiled_geometry {
+  public:
+    Rtiled_memory(int64_t rows, int64_t cols, int64_t tile, mp_bitcnt_t prec) {
+        set_geometry(rows, cols, tile, prec);
+        count_ = mt_ * nt_ * tile_ * tile_;
+        entries_.reset(new mpf_t[count_]);
+        for (int64_t e = 0; e < count_; ++e) {
+            mpf_init2(entries_[e], prec);
+        }
+    }
+    ~Rtiled_memory() {
+        for (int64_t e = 0; e < count_; ++e) {
+            mpf_clear(entries_[e]);
+        }
+    }
+    Rtiled_memory(const Rtiled_memory &) = delete;
+    Rtiled_memory &operator=(const Rtiled_memory &) = delete;
+
+    mpf_t *acquire(int64_t it, int64_t jt) { return &entries_[(it + jt * mt_) * tile_ * tile_]; }
+    void release(int64_t, int64_t) {}
+    void prefetch(int64_t, int64_t) {}
+    uint64_t maps() const { return 0; }
+    int64_t peak_mapped() const { return mt_ * nt_; }
+
+  private:
+    int64_t count_ = 0;
+    std::unique_ptr<mpf_t[]> entries_;
+};
+
+// Tiles in a file, mapped on demand; see the layout above.
+class Rtiled_file : public Rtiled_geometry {
+  public:
+    // Creates path, replacing any file there, for a zero rows x cols matrix.
+    Rtiled_file(const std::string &path, int64_t rows, int64_t cols, int64_t tile, mp_bitcnt_t prec, int64_t capacity) : capacity_(std::max<int64_t>(capacity, 1)) {
+        set_geometry(rows, cols, tile, prec);
+        fd_ = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (fd_ < 0) {
+            throw std::system_error(errno, std::generic_category(), "Rtiled_file: open " + path);
+        }
+        Rtiled_header header{};
+        std::memcpy(header.magic, Rtiled_magic, sizeof header.magic);
+        header.version = Rtiled_version;
+        header.rows = (uint64_t)rows;
+        header.cols = (uint64_t)cols;
+        header.tile = (uint64_t)tile;
+        header.precision = prec;
+        header.entry_limbs = (uint64_t)(2 + Rtiled_prec_limbs(prec) + 1);
+        header.tile_bytes = round_up((uint64_t)(tile * tile) * header.entry_limbs * sizeof(mp_limb_t));
+        set_layout(header);
+        if (::ftruncate(fd_, (off_t)(Rtiled_alignment + (uint64_t)(mt_ * nt_) * tile_bytes_)) != 0 || ::pwrite(fd_, &header, sizeof header, 0) != (ssize_t)sizeof header) {
+            const int error = errno;
+            ::close(fd_);
+            throw std::system_error(error, std::generic_category(), "Rtiled_file: size " + path);
+        }
+    }
+
+    // Opens a file written by the constructor above.
+    Rtiled_file(const std::string &path, int64_t capacity) : capacity_(std::max<int64_t>(capacity, 1)) {
+        fd_ = ::open(path.c_str(), O_RDWR);
+        if (fd_ < 0) {
+            throw std::system_error(errno, std::generic_category(), "Rtiled_file: open " + path);
+        }
+        Rtiled_header header{};
+        struct stat st {};
+        if (::pread(fd_, &header, sizeof header, 0) != (ssize_t)sizeof header || std::memcmp(header.magic, Rtiled_magic, sizeof header.magic) != 0 || header.version != Rtiled_version || header.tile == 0 || header.precision == 0 ||
+            header.entry_limbs != (uint64_t)(2 + Rtiled_prec_limbs(header.precision) + 1) || ::fstat(fd_, &st) != 0) {
+            ::close(fd_);
+            throw std::runtime_error("Rtiled_file: not a tiled matrix file: " + path);
+        }
+        set_geometry((int64_t)header.rows, (int64_t)header.cols, (int64_t)header.tile, header.precision);
+        set_layout(header);
+        if ((uint64_t)st.st_size < Rtiled_alignment + (uint64_t)(mt_ * nt_) * tile_bytes_) {
+            ::close(fd_);
+            throw std::runtime_error("Rtiled_file: truncated file: " + path);
+        }
+    }
+
+    ~Rtiled_file() {
+        for (int64_t t = 0; t < (int64_t)slots_.size(); ++t) {
+            if (slots_[t].base != nullptr) {
+                unmap(t);
+            }
+        }
+        ::close(fd_);
+    }
+    Rtiled_file(const Rtiled_file &) = delete;
+    Rtiled_file &operator=(const Rtiled_file &) = delete;
+
+    // The tile's entries, valid until the matching release.  Tiles may be
+    // acquired more than once; the working set exceeds the capacity only
+    // while more tiles than that are pinned.
+    mpf_t *acquire(int64_t it, int64_t jt) {
+        const int64_t t = it + jt * mt_;
+        Rtiled_slot &s = slots_[t];
+        if (s.base == nullptr) {
+            while (mapped_ >= capacity_ && evict()) {
+            }
+            map(t);
+        }
+        ++s.pins;
+        s.tick = ++clock_;
+        return s.entries.get();
+    }
+
+    void release(int64_t it, int64_t jt) { --slots_[it + jt * mt_].pins; }
+
+    // Starts reading a tile that is not mapped yet.
+    void prefetch(int64_t it, int64_t jt) {
+        const int64_t t = it + jt * mt_;
+        if (slots_[t].base == nullptr) {
+            ::posix_fadvise(fd_, (off_t)offset(t), (off_t)tile_bytes_, POSIX_FADV_WILLNEED);
+        }
+    }
+
+    // Number of times a tile was mapped, and the most tiles mapped at once.
+    uint64_t maps() const { return maps_; }
+    int64_t peak_mapped() const { return peak_mapped_; }
+
+  private:
+    struct Rtiled_slot {
+        void *base = nullptr;
+        std::unique_ptr<mpf_t[]> entries;
+        int64_t pins = 0;
+        uint64_t tick = 0;
+    };
+
+    static uint64_t round_up(uint64_t bytes) { return (bytes + Rtiled_alignment - 1) / Rtiled_alignment * Rtiled_alignment; }
+
+    void set_layout(const Rtiled_header &header) {
+        entry_limbs_ = (int64_t)header.entry_limbs;
+        tile_bytes_ = header.tile_bytes;
+        slots_.resize(mt_ * nt_);
+    }
+
+    uint64_t offset(int64_t t) const { return Rtiled_alignment + (uint64_t)t * tile_bytes_; }
+
+    void map(int64_t t) {
+        Rtiled_slot &s = slots_[t];
+        void *base = ::mmap(nullptr, tile_bytes_, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, (off_t)offset(t));
+        if (base == MAP_FAILED) {
+            throw std::system_error(errno, std::generic_category(), "Rtiled_file: mmap");
+        }
+        if (!s.entries) {
+            s.entries.reset(new mpf_t[tile_ * tile_]);
+        }
+        const int prec_limbs = (int)(entry_limbs_ - 3);
+        mp_limb_t *record = static_cast<mp_limb_t *>(base);
+        for (int64_t e = 0; e < tile_ * tile_; ++e, record += entry_limbs_) {
+            __mpf_struct &x = s.entries[e][0];
+            x._mp_prec = prec_limbs;
+            x._mp_size = (int)(int64_t)record[0];
+            x._mp_exp = (mp_exp_t)(int64_t)record[1];
+            x._mp_d = record + 2;
+        }
+        s.base = base;
+        ++maps_;
+        peak_mapped_ = std::max(peak_mapped_, ++mapped_);
+    }
+
+    void unmap(int64_t t) {
+        Rtiled_slot &s = slots_[t];
+        mp_limb_t *record = static_cast<mp_limb_t *>(s.base);
+        for (int64_t e = 0; e < tile_ * tile_; ++e, record += entry_limbs_) {
+            record[0] = (mp_limb_t)(int64_t)s.entries[e]->_mp_size;
+            record[1] = (mp_limb_t)(int64_t)s.entries[e]->_mp_exp;
+        }
+        ::munmap(s.base, tile_bytes_);
+        s.base = nullptr;
+        --mapped_;
+    }
+
+    // Unmaps the least recently used unpinned tile; false if all are pinned.
+    bool evict() {
+        int64_t victim = -1;
+        for (int64_t t = 0; t < (int64_t)slots_.size(); ++t) {
+            const Rtiled_slot &s = slots_[t];
+            if (s.base != nullptr && s.pins == 0 && (victim < 0 || s.tick < slots_[victim].tick)) {
+                victim = t;
+            }
+        }
+        if (victim < 0) {
+            return false;
+        }
+        unmap(victim);
+        return true;
+    }
+
+    int fd_ = -1;
+    int64_t capacity_;
+    int64_t entry_limbs_ = 0;
+    uint64_t tile_bytes_ = 0;
+    std::vector<Rtiled_slot> slots_;
+    int64_t mapped_ = 0;
+    int64_t peak_mapped_ = 0;
+    uint64_t maps_ = 0;
+    uint64_t clock_ = 0;
+};
+
+// Pins one tile for the lifetime of the object.
+template <class Store> class Rtile_ref {
+  public:
+    Rtile_ref(Store &store, int64_t it, int64_t jt) : store_(store), it_(it), jt_(jt), data_(store.acquire(it, jt)) {}
+    ~Rtile_ref() { store_.release(it_, jt_); }
+    Rtile_ref(const Rtile_ref &) = delete;
+    Rtile_ref &operator=(const Rtile_ref &) = delete;
+
+    mpf_t *data() const { return data_; }
+
+  private:
+    Store &store_;
+    int64_t it_, jt_;
+    mpf_t *data_;
+};
+
+// Block kernels on column-major mpf_t arrays.  They work on in-memory
+// arrays and on mapped tiles alike.
+
+// Columns of C per task in Rgemm_block.
+inline constexpr int64_t Rgemm_block_cols = 16;
+
+// C := C + alpha * A * B, with A m x k, B k x n, and C m x n.  A tile is
+// usually a single engine tile, so Rgemm_packed would give it to one
+// thread.  The engine tiles are cut into Rgemm_block_cols column strips
+// instead, which are shared out over OpenMP threads.
+inline void Rgemm_block(int64_t m, int64_t n, int64_t k, mpf_srcptr alpha, const mpf_t *A, int64_t lda, const mpf_t *B, int64_t ldb, mpf_t *C, int64_t ldc) {
+    if (m <= 0 || n <= 0 || k <= 0) {
+        return;
+    }
+    const mp_bitcnt_t prec = mpf_get_prec(C[0]);
+    const int64_t mt = (m + Rgemm_packed_mb - 1) / Rgemm_packed_mb;
+    const int64_t nt = (n + Rgemm_block_cols - 1) / Rgemm_block_cols;
+#if defined(_OPENMP)
+#pragma omp parallel
+#endif
+    {
+        Rgemm_packed_workspace work(prec);
+#if defined(_OPENMP)
+#pragma omp for collapse(2) schedule(static)
+#endif
+        for (int64_t jt = 0; jt < nt; ++jt) {
+            for (int64_t it = 0; it < mt; ++it) {
+                const int64_t i = it * Rgemm_packed_mb;
+                const int64_t j = jt * Rgemm_block_cols;
+                const int64_t mb = std::min(Rgemm_packed_mb, m - i);
+                const int64_t nb = std::min(Rgemm_block_cols, n - j);
+                Rgemm_tile(Rgemm_packed_shape::full, false, false, mb, nb, k, alpha, &A[i], lda, &B[j * ldb], ldb, &C[i + j * ldc], ldc, work);
+            }
+        }
+    }
+}
+
+// B := inv(L) * B, with L the m x m unit lower triangle of A and B m x n.
+// This is the unblocked loop that Rtrsm runs on its diagonal blocks; in
+// Rgetrf_tiled it is one tile per tile column, a small part of the flops.
+inline void Rtrsm_block_LLNU(int64_t m, int64_t n, const mpf_t *A, int64_t lda, mpf_t *B, int64_t ldb) {
+    if (m <= 0 || n <= 0) {
+        return;
+    }
+    const mp_bitcnt_t prec = mpf_get_prec(B[0]);
+#if defined(_OPENMP)
+#pragma omp parallel
+#endif
+    {
+        mpf_t temp;
+        mpf_init2(temp, prec);
+#if defined(_OPENMP)
+#pragma omp for schedule(static)
+#endif
+        for (int64_t j = 0; j < n; ++j) {
+            for (int64_t l = 0; l < m; ++l) {
+                if (mpf_sgn(B[l + j * ldb]) == 0) {
+                    continue;
+                }
+                for (int64_t i = l + 1; i < m; ++i) {
+                    mpf_mul(temp, B[l + j * ldb], A[i + l * lda]);
+                    mpf_sub(B[i + j * ldb], B[i + j * ldb], temp);
+                }
+            }
+        }
+        mpf_clear(temp);
+    }
+}
+
+// Exchanges the values of a and b.  mpf_swap would exchange the limb
+// pointers, which must stay with their records in a mapped tile.
+inline void Rtiled_swap(mpf_ptr a, mpf_ptr b, mpf_ptr temp) {
+    mpf_set(temp, a);
+    mpf_set(a, b);
+    mpf_set(b, temp);
+}
+
+// Compares |a| and |b|.  GMP has no mpf_cmpabs; the copies share the limbs.
+inline int Rtiled_cmpabs(mpf_srcptr a, mpf_srcptr b) {
+    __mpf_struct x = *a;
+    __mpf_struct y = *b;
+    x._mp_size = std::abs(x._mp_size);
+    y._mp_size = std::abs(y._mp_size);
+    return mpf_cmp(&x, &y);
+}
+
+// Fills one tile with uniform values in [0, 1) from a state seeded by the
+// tile position, so any tile can be regenerated alone.
+inline void Rtiled_random_tile(int64_t it, int64_t jt, int64_t rows, int64_t cols, int64_t ld, mp_bitcnt_t prec, unsigned long seed, mpf_t *tile) {
+    gmp_randstate_t state;
+    gmp_randinit_default(state);
+    gmp_randseed_ui(state, seed + 1000003ul * (unsigned long)it + 998244353ul * (unsigned long)jt);
+    for (int64_t j = 0; j < cols; ++j) {
+        for (int64_t i = 0; i < rows; ++i) {
+            mpf_urandomb(tile[i + j * ld], state, prec);
+        }
+    }
+    gmp_randclear(state);
+}
+
+template <class Store> inline void Rtiled_fill_random(Store &A, unsigned long seed) {
+    for (int64_t jt = 0; jt < A.nt(); ++jt) {
+        for (int64_t it = 0; it < A.mt(); ++it) {
+            Rtile_ref<Store> a(A, it, jt);
+            Rtiled_random_tile(it, jt, A.tile_rows(it), A.tile_cols(jt), A.tile(), A.precision(), seed, a.data());
+        }
+    }
+}
+
+// C := alpha * A * B + beta * C on tiled matrices of one tile size.  Each
+// tile of C is finished before the next: it is scaled, and then the
+// products of the tile row of A and the tile column of B are added to it
+// pair by pair, with the next pair prefetched.
+template <class StoreA, class StoreB, class StoreC> inline void Rgemm_tiled(mpf_srcptr alpha, StoreA &A, StoreB &B, mpf_srcptr beta, StoreC &C) {
+    const int64_t T = C.tile();
+    if (A.rows() != C.rows() || B.cols() != C.cols() || A.cols() != B.rows() || A.tile() != T || B.tile() != T) {
+        throw std::invalid_argument("Rgemm_tiled: nonconformant matrices");
+    }
+    for (int64_t jt = 0; jt < C.nt(); ++jt) {
+        for (int64_t it = 0; it < C.mt(); ++it) {
+            const int64_t mb = C.tile_rows(it);
+            const int64_t nb = C.tile_cols(jt);
+            Rtile_ref<StoreC> c(C, it, jt);
+            for (int64_t j = 0; j < nb; ++j) {
+                for (int64_t i = 0; i < mb; ++i) {
+                    mpf_mul(c.data()[i + j * T], c.data()[i + j * T], beta);
+                }
+            }
+            for (int64_t lt = 0; lt < A.nt(); ++lt) {
+                if (lt + 1 < A.nt()) {
+                    A.prefetch(it, lt + 1);
+                    B.prefetch(lt + 1, jt);
+                } else if (it + 1 < C.mt()) {
+                    C.prefetch(it + 1, jt);
+                    A.prefetch(it + 1, 0);
+                } else if (jt + 1 < C.nt()) {
+                    C.prefetch(0, jt + 1);
+                    B.prefetch(0, jt + 1);
+                }
+                Rtile_ref<StoreA> a(A, it, lt);
+                Rtile_ref<StoreB> b(B, lt, jt);
+                Rgemm_block(mb, nb, A.tile_cols(lt), alpha, a.data(), T, b.data(), T, c.data(), T);
+            }
+        }
+    }
+}
+
+// Right-looking LU with partial pivoting, A = P * L * U, of the n x n tiled
+// matrix A, one tile column of panel at a time:
+//
+//   1. the panel (tile rows kt.. of tile column kt) is factored unblocked
+//      with pivots searched over all of its rows;
+//   2. the panel's row interchanges are applied to every other tile column;
+//   3. for each tile column right of the panel, its tile in the panel's
+//      tile row is solved with the unit lower triangle, and the tiles below
+//      are updated by Rgemm_block.
+//
+// Step 3 holds almost all of the flops.  The panel stays pinned while the
+// tile columns stream past it, so the working set is the panel plus the
+// column being updated.  ipiv[g] is the row interchanged with row g.
+// Returns 0, or g + 1 for the first zero pivot g.
+template <class Store> inline int64_t Rgetrf_tiled(Store &A, std::vector<int64_t> &ipiv) {
+    const int64_t n = A.rows();
+    const int64_t T = A.tile();
+    if (A.cols() != n) {
+        throw std::invalid_argument("Rgetrf_tiled: matrix is not square");
+    }
+    ipiv.assign(n, 0);
+    int64_t info = 0;
+    mpf_t temp, minus_one;
+    mpf_init2(temp, A.precision());
+    mpf_init_set_si(minus_one, -1);
+    std::vector<mpf_t *> panel(A.mt());
+    for (int64_t kt = 0; kt < A.nt(); ++kt) {
+        const int64_t k0 = kt * T;
+        const int64_t kb = A.tile_cols(kt);
+        for (int64_t it = kt; it < A.mt(); ++it) {
+            panel[it] = A.acquire(it, kt);
+        }
+        auto at = [&](int64_t g, int64_t c) -> mpf_ptr { return panel[g / T][(g % T) + c * T]; };
+
+        // 1. Unblocked LU of the panel
+        for (int64_t c = 0; c < kb; ++c) {
+            const int64_t g0 = k0 + c;
+            int64_t p = g0;
+            for (int64_t g = g0 + 1; g < n; ++g) {
+                if (Rtiled_cmpabs(at(g, c), at(p, c)) > 0) {
+                    p = g;
+                }
+            }
+            ipiv[g0] = p;
+            if (mpf_sgn(at(p, c)) == 0) {
+                if (info == 0) {
+                    info = g0 + 1;
+                }
+                continue;
+            }
+            if (p != g0) {
+                for (int64_t cc = 0; cc < kb; ++cc) {
+                    Rtiled_swap(at(g0, cc), at(p, cc), temp);
+                }
+            }
+            for (int64_t g = g0 + 1; g < n; ++g) {
+                mpf_div(at(g, c), at(g, c), at(g0, c));
+            }
+            for (int64_t cc = c + 1; cc < kb; ++cc) {
+                for (int64_t g = g0 + 1; g < n; ++g) {
+                    mpf_mul(temp, at(g, c), at(g0, cc));
+                    mpf_sub(at(g, cc), at(g, cc), temp);
+                }
+            }
+        }
+
+        for (int64_t jt = 0; jt < A.nt(); ++jt) {
+            if (jt == kt) {
+                continue;
+            }
+            const int64_t nb = A.tile_cols(jt);
+            // 2. Row interchanges; row g0 lies in tile row kt
+            {
+                Rtile_ref<Store> top(A, kt, jt);
+                for (int64_t c = 0; c < kb; ++c) {
+                    const int64_t g0 = k0 + c;
+                    const int64_t p = ipiv[g0];
+                    if (p == g0) {
+                        continue;
+                    }
+                    Rtile_ref<Store> other(A, p / T, jt);
+                    for (int64_t j = 0; j < nb; ++j) {
+                        Rtiled_swap(top.data()[c + j * T], other.data()[(p % T) + j * T], temp);
+                    }
+                }
+            }
+            if (jt < kt) {
+                continue;
+            }
+            // 3. U(kt, jt) := inv(L(kt, kt)) * A(kt, jt), then the tiles below
+            Rtile_ref<Store> u(A, kt, jt);
+            Rtrsm_block_LLNU(kb, nb, panel[kt], T, u.data(), T);
+            for (int64_t it = kt + 1; it < A.mt(); ++it) {
+                if (it + 1 < A.mt()) {
+                    A.prefetch(it + 1, jt);
+                } else if (jt + 1 < A.nt()) {
+                    A.prefetch(kt, jt + 1);
+                }
+                Rtile_ref<Store> a(A, it, jt);
+                Rgemm_block(A.tile_rows(it), nb, kb, minus_one, panel[it], T, u.data(), T, a.data(), T);
+            }
+        }
+        for (int64_t it = kt; it < A.mt(); ++it) {
+            A.release(it, kt);
+        }
+    }
+    mpf_clear(temp);
+    mpf_clear(minus_one);
+    return info;
+}
+
+// y := A * x for a tiled matrix, streaming the tiles once.  (Part selects
+// the whole matrix, its unit lower triangle, or its upper triangle.)
+enum class Rtiled_part { full, unit_lower, upper };
+
+template <class Store> inline void Rtiled_gemv(Rtiled_part part, Store &A, const mpf_t *x, mpf_t *y) {
+    const int64_t T = A.tile();
+    mpf_t temp;
+    mpf_init2(temp, mpf_get_prec(y[0]));
+    for (int64_t i = 0; i < A.rows(); ++i) {
+        if (part == Rtiled_part::unit_lower) {
+            mpf_set(y[i], x[i]);
+        } else {
+            mpf_set_ui(y[i], 0);
+        }
+    }
+    for (int64_t jt = 0; jt < A.nt(); ++jt) {
+        for (int64_t it = 0; it < A.mt(); ++it) {
+            if ((part == Rtiled_part::unit_lower && it < jt) || (part == Rtiled_part::upper && it > jt)) {
+                continue;
+            }
+            if (it + 1 < A.mt()) {
+                A.prefetch(it + 1, jt);
+            }
+            Rtile_ref<Store> a(A, it, jt);
+            for (int64_t j = 0; j < A.tile_cols(jt); ++j) {
+                const int64_t gj = jt * T + j;
+                for (int64_t i = 0; i < A.tile_rows(it); ++i) {
+                    const int64_t gi = it * T + i;
+                    if ((part == Rtiled_part::unit_lower && gi <= gj) || (part == Rtiled_part::upper && gi > gj)) {
+                        continue;
+                    }
+                    mpf_mul(temp, a.data()[i + j * T], x[gj]);
+                    mpf_add(y[gi], y[gi], temp);
+                }
+            }
+        }
+    }
+    mpf_clear(temp);
+}
+
+// L1 norm of C * x - alpha * A * (B * x), which vanishes when C = alpha * A * B
+// (Freivalds' check).  It costs three streams over the tiles, O(n^2).
+template <class StoreA, class StoreB, class StoreC> inline void Rgemm_tiled_residual(mpf_srcptr alpha, StoreA &A, StoreB &B, StoreC &C, const mpf_t *x, mpf_ptr norm) {
+    const int64_t m = C.rows();
+    const int64_t k = A.cols();
+    const mp_bitcnt_t prec = C.precision();
+    std::vector<__mpf_struct> buffer(m + k + m);
+    for (__mpf_struct &v : buffer) {
+        mpf_init2(&v, prec);
+    }
+    mpf_t *cx = reinterpret_cast<mpf_t *>(&buffer[0]);
+    mpf_t *bx = reinterpret_cast<mpf_t *>(&buffer[m]);
+    mpf_t *abx = reinterpret_cast<mpf_t *>(&buffer[m + k]);
+    Rtiled_gemv(Rtiled_part::full, C, x, cx);
+    Rtiled_gemv(Rtiled_part::full, B, x, bx);
+    Rtiled_gemv(Rtiled_part::full, A, bx, abx);
+    mpf_set_ui(norm, 0);
+    for (int64_t i = 0; i < m; ++i) {
+        mpf_mul(abx[i], abx[i], alpha);
+        mpf_sub(cx[i], cx[i], abx[i]);
+        mpf_abs(cx[i], cx[i]);
+        mpf_add(norm, norm, cx[i]);
+    }
+    for (__mpf_struct &v : buffer) {
+        mpf_clear(&v);
+    }
+}
+
+// L1 norm of P^T * A * x - L * (U * x) after Rgetrf_tiled, where A is
+// regenerated tile by tile from the seed given to Rtiled_fill_random.
+template <class Store> inline void Rgetrf_tiled_residual(Store &LU, const std::vector<int64_t> &ipiv, unsigned long seed, const mpf_t *x, mpf_ptr norm) {
+    const int64_t n = LU.rows();
+    const int64_t T = LU.tile();
+    const mp_bitcnt_t prec = LU.precision();
+    std::vector<__mpf_struct> buffer(3 * n + T * T + 1);
+    for (__mpf_struct &v : buffer) {
+        mpf_init2(&v, prec);
+    }
+    mpf_t *ax = reinterpret_cast<mpf_t *>(&buffer[0]);
+    mpf_t *ux = reinterpret_cast<mpf_t *>(&buffer[n]);
+    mpf_t *lux = reinterpret_cast<mpf_t *>(&buffer[2 * n]);
+    mpf_t *tile = reinterpret_cast<mpf_t *>(&buffer[3 * n]);
+    mpf_t *temp = reinterpret_cast<mpf_t *>(&buffer[3 * n + T * T]);
+    for (int64_t i = 0; i < n; ++i) {
+        mpf_set_ui(ax[i], 0);
+    }
+    for (int64_t jt = 0; jt < LU.nt(); ++jt) {
+        for (int64_t it = 0; it < LU.mt(); ++it) {
+            Rtiled_random_tile(it, jt, LU.tile_rows(it), LU.tile_cols(jt), T, prec, seed, tile);
+            for (int64_t j = 0; j < LU.tile_cols(jt); ++j) {
+                for (int64_t i = 0; i < LU.tile_rows(it); ++i) {
+                    mpf_mul(*temp, tile[i + j * T], x[jt * T + j]);
+                    mpf_add(ax[it * T + i], ax[it * T + i], *temp);
+                }
+            }
+        }
+    }
+    for (int64_t g = 0; g < n; ++g) {
+        if (ipiv[g] != g) {
+            mpf_swap(ax[g], ax[ipiv[g]]);
+        }
+    }
+    Rtiled_gemv(Rtiled_part::upper, LU, x, ux);
+    Rtiled_gemv(Rtiled_part::unit_lower, LU, ux, lux);
+    mpf_set_ui(norm, 0);
+    for (int64_t i = 0; i < n; ++i) {
+        mpf_sub(ax[i], ax[i], lux[i]);
+        mpf_abs(ax[i], ax[i]);
+        mpf_add(norm, norm, ax[i]);
+    }
+    for (__mpf_struct &v : buffer) {
+        mpf_clear(&v);
+    }
+}
+
+// cf. https://netlib.org/lapack/lawnspdf/lawn41.pdf p.120-121
+inline double flops_gemm_tiled(int64_t m_i, int64_t k_i, int64_t n_i) {
+    double m = (double)m_i;
+    double k = (double)k_i;
+    double n = (double)n_i;
+    return 2.0 * m * k * n + m * n;
+}
+
+inline double flops_getrf_tiled(int64_t n_i) {
+    double n = (double)n_i;
+    return 2.0 / 3.0 * n * n * n - 0.5 * n * n + 5.0 / 6.0 * n;
+}
+
+// Path of a scratch file for a tiled matrix: $TMPDIR (or /tmp), the given
+// name, and the process id.
+inline std::string Rtiled_scratch_path(const char *name) {
+    const char *dir = std::getenv("TMPDIR");
+    return std::string(dir != nullptr && *dir != '\0' ? dir : "/tmp") + "/" + name + "_" + std::to_string((long)::getpid()) + ".tiles";
+}
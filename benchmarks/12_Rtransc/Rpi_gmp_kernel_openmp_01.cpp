@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2026
+ *      Nakata, Maho
+ *      All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ */
+
+#include <iostream>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+
+#include "gmpxx_mkII.h"
+#if !defined ___GMPXX_STRICT_COMPATIBILITY___
+using namespace gmpxx;
+#endif
+
+// Time to compute pi at a precision, with the Gauss-Legendre (AGM)
+// iteration or the Chudnovsky series.  With a starting precision, the
+// Chudnovsky series is first computed there outside the timing and then
+// extended to the precision, as when a program asks for more digits.
+
+#include <omp.h>
+
+// The Chudnovsky product tree runs as OpenMP tasks on all threads.
+
+// Bits checked against the other method.
+inline constexpr int Rpi_check_bits = 100000;
+
+mpf_class _Rpi(const char *method, int prec) {
+    if (std::strcmp(method, "agm") == 0) {
+        return gmpxx_transcendent_detail::compute_pi_gauss_legendre(prec);
+    }
+    return gmpxx_transcendent_detail::chudnovsky_pi().pi(prec);
+}
+
+int main(int argc, char **argv) {
+    // Check command-line arguments
+    if ((argc != 3 && argc != 4) ||
+        (std::strcmp(argv[1], "agm") != 0 && std::strcmp(argv[1], "chudnovsky") != 0) ||
+        (argc == 4 && std::strcmp(argv[1], "chudnovsky") != 0)) {
+        std::cerr << "Usage: " << argv[0] << " <method agm|chudnovsky> <precision> [chudnovsky starting precision]" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    const char *method = argv[1];
+    int prec = std::atoi(argv[2]); // Precision in bits
+    if (argc == 4) {
+        (void)_Rpi(method, std::atoi(argv[3]));
+    }
+
+    // Perform _Rpi
+    auto start = std::chrono::high_resolution_clock::now();
+    mpf_class pi_value = _Rpi(method, prec);
+    auto end = std::chrono::high_resolution_clock::now();
+
+    std::chrono::duration<double> elapsed = end - start;
+
+    // Output performance metrics
+    std::cout << "Elapsed time: " << elapsed.count() << " s" << std::endl;
+
+    // Difference from the other method on the leading bits
+    const int check = prec < Rpi_check_bits ? prec : Rpi_check_bits;
+    mpf_class other = std::strcmp(method, "agm") == 0
+                          ? gmpxx_transcendent_detail::chudnovsky_pi().pi(check)
+                          : gmpxx_transcendent_detail::compute_pi_gauss_legendre(check);
+    mpf_class difference(0, check);
+    mpf_sub(difference.get_mpf_t(), pi_value.get_mpf_t(), other.get_mpf_t());
+    mpf_abs(difference.get_mpf_t(), difference.get_mpf_t());
+    std::cout << "Difference on the leading " << check << " bits: ";
+    gmp_printf("%.4Fg\n", difference.get_mpf_t());
+
+    // Verify correctness
+    mpf_class threshold(1, check);
+    mpf_div_2exp(threshold.get_mpf_t(), threshold.get_mpf_t(), check - 8);
+    if (difference < threshold) {
+        std::cout << "Result OK" << std::endl;
+    } else {
+        std::cout << "Result NG" << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+}
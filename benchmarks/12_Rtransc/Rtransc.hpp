@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2026
+ *      Nakata, Maho
+ *      All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ */
+
+#pragma once
+
+// Per-call cost of the elementary functions: y_i := f(x_i) for f one of
+// exp, log, sin, atan and tan, on n random arguments.  sincos stores
+// sin(x_i) + cos(x_i) from one sincos call, and sin_cos the same sum from
+// separate sin and cos calls, so the two show what the shared reduction
+// saves.  The arguments cover the ranges the argument reductions see in
+// practice:
+//
+//   exp:  x in [-8, 8)
+//   log:  x in [1/8, 16 + 1/8)
+//   others: x in [-8, 8)
+//
+// Each evaluation counts as one operation, so MFLOPS reads as millions of
+// calls per second.  Rtransc_residual checks the first results against an
+// identity that uses a second function:
+//
+//   exp:  exp(x) * exp(-x) - 1
+//   log:  exp(log(x)) / x - 1
+//   sin:  sin(x)^2 + cos(x)^2 - 1
+//   atan: sin(atan(x)) / cos(atan(x)) - x
+//   tan:  tan(x) cos(x) - sin(x)
+//   sincos, sin_cos: (sin(x) + cos(x))^2 - 1 - sin(2x)
+
+#include <cstdint>
+#include <cstring>
+
+// Number of leading results Rtransc_residual checks.
+inline constexpr int64_t Rtransc_residual_count = 64;
+
+inline bool Rtransc_function_known(const char *function) {
+    return std::strcmp(function, "exp") == 0 || std::strcmp(function, "log") == 0 ||
+           std::strcmp(function, "sin") == 0 || std::strcmp(function, "atan") == 0 ||
+           std::strcmp(function, "tan") == 0 || std::strcmp(function, "sincos") == 0 ||
+           std::strcmp(function, "sin_cos") == 0;
+}
+
+inline void Rtransc_arguments(const char *function, int64_t n, mpf_class *x, gmp_randclass &r, int prec) {
+    for (int64_t i = 0; i < n; ++i) {
+        mpf_class u = r.get_f(prec);
+        mpf_mul_2exp(u.get_mpf_t(), u.get_mpf_t(), 4);
+        if (std::strcmp(function, "log") == 0) {
+            mpf_class eighth(1, prec);
+            mpf_div_2exp(eighth.get_mpf_t(), eighth.get_mpf_t(), 3);
+            x[i] = u + eighth;
+        } else {
+            x[i] = u - 8;
+        }
+    }
+}
+
+inline mpf_class Rtransc_eval(const char *function, const mpf_class &x) {
+    if (std::strcmp(function, "exp") == 0) {
+        return exp(x);
+    }
+    if (std::strcmp(function, "log") == 0) {
+        return log(x);
+    }
+    if (std::strcmp(function, "sin") == 0) {
+        return sin(x);
+    }
+    if (std::strcmp(function, "tan") == 0) {
+        return tan(x);
+    }
+    if (std::strcmp(function, "sincos") == 0) {
+        auto [s, c] = sincos(x);
+        return s + c;
+    }
+    if (std::strcmp(function, "sin_cos") == 0) {
+        return sin(x) + cos(x);
+    }
+    return atan(x);
+}
+
+// y_i := f(x_i).  Each thread evaluates a contiguous block of arguments.
+// A single argument is evaluated outside the parallel region, so that the
+// binary splitting of exp, sin and atan at very high precision spreads its
+// recursion over the threads instead.
+inline void Rtransc(const char *function, int64_t n, const mpf_class *x, mpf_class *y) {
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(static) if (n > 1)
+#endif
+    for (int64_t i = 0; i < n; ++i) {
+        y[i] = Rtransc_eval(function, x[i]);
+    }
+}
+
+inline mpf_class Rtransc_residual(const char *function, int64_t n, const mpf_class *x, const mpf_class *y) {
+    const int prec = static_cast<int>(mpf_get_prec(x[0].get_mpf_t()));
+    mpf_class norm(0, prec);
+    for (int64_t i = 0; i < n && i < Rtransc_residual_count; ++i) {
+        mpf_class diff(0, prec);
+        if (std::strcmp(function, "exp") == 0) {
+            diff = y[i] * exp(mpf_class(-x[i])) - 1;
+        } else if (std::strcmp(function, "log") == 0) {
+            diff = exp(y[i]) / x[i] - 1;
+        } else if (std::strcmp(function, "sin") == 0) {
+            diff = y[i] * y[i] + cos(x[i]) * cos(x[i]) - 1;
+        } else if (std::strcmp(function, "tan") == 0) {
+            diff = y[i] * cos(x[i]) - sin(x[i]);
+        } else if (std::strcmp(function, "sincos") == 0 ||
+                   std::strcmp(function, "sin_cos") == 0) {
+            diff = y[i] * y[i] - 1 - sin(mpf_class(x[i] + x[i]));
+        } else {
+            diff = sin(y[i]) / cos(y[i]) - x[i];
+        }
+        norm += abs(diff);
+    }
+    return norm;
+}
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2026
+ *      Nakata, Maho
+ *      All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ */
+
+#include <iostream>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+
+#include "gmpxx_mkII.h"
+#if !defined ___GMPXX_STRICT_COMPATIBILITY___
+using namespace gmpxx;
+#endif
+
+#include "Rtransc.hpp"
+
+#define MFLOPS 1e+6
+
+// One evaluation after another on a single thread.
+void _Rtransc(const char *function, int64_t n, const mpf_class *x, mpf_class *y) {
+    Rtransc(function, n, x, y);
+}
+
+int main(int argc, char **argv) {
+    // Initialize random state
+    gmp_randclass r(gmp_randinit_default);
+    r.seed(42);
+
+    // Check command-line arguments
+    // The optional table mode picks how exp and log get their log tables:
+    // auto builds one after enough calls, warm builds it and the cached
+    // constants before the timed loop, and off runs without tables.
+    const char *tables = argc == 5 ? argv[4] : "auto";
+    if ((argc != 4 && argc != 5) || !Rtransc_function_known(argv[1]) ||
+        (std::strcmp(tables, "auto") != 0 && std::strcmp(tables, "warm") != 0 &&
+         std::strcmp(tables, "off") != 0)) {
+        std::cerr << "Usage: " << argv[0] << " <function exp|log|sin|atan|tan|sincos|sin_cos> <count n> <precision> [tables auto|warm|off]" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    const char *function = argv[1];
+    int64_t N = std::atoll(argv[2]); // Number of arguments
+    int prec = std::atoi(argv[3]);   // Precision in bits
+    mpf_set_default_prec(prec);
+    gmpxx::gmpxx_defaults::set_initial_default_prec(prec);
+
+    mpf_class *x = new mpf_class[N];
+    mpf_class *y = new mpf_class[N];
+    Rtransc_arguments(function, N, x, r, prec);
+
+    if (std::strcmp(tables, "off") == 0) {
+        gmpxx::gmpxx_transcendental_tables::set_memory_budget(0);
+    } else if (std::strcmp(tables, "warm") == 0) {
+        auto warm_start = std::chrono::high_resolution_clock::now();
+        gmpxx::gmpxx_transcendental_tables::warm_up(prec);
+        std::chrono::duration<double> warm_elapsed =
+            std::chrono::high_resolution_clock::now() - warm_start;
+        std::cout << "Table warm-up time: " << warm_elapsed.count() << " s" << std::endl;
+        warm_start = std::chrono::high_resolution_clock::now();
+        gmpxx::warm_constants(prec);
+        warm_elapsed = std::chrono::high_resolution_clock::now() - warm_start;
+        std::cout << "Constant warm-up time: " << warm_elapsed.count() << " s" << std::endl;
+    }
+
+    // Perform _Rtransc
+    auto start = std::chrono::high_resolution_clock::now();
+    _Rtransc(function, N, x, y);
+    auto end = std::chrono::high_resolution_clock::now();
+
+    std::chrono::duration<double> elapsed = end - start;
+    double mflops = static_cast<double>(N) / (elapsed.count() * MFLOPS);
+
+    // Output performance metrics
+    std::cout << "Elapsed time: " << elapsed.count() << " s" << std::endl;
+    std::cout << "MFLOPS: " << mflops << std::endl;
+    std::cout << "Microseconds per call: " << elapsed.count() * 1e6 / static_cast<double>(N) << std::endl;
+
+    // L1 norm of the identity residuals of the first results
+    mpf_class l1_norm = Rtransc_residual(function, N, x, y);
+    std::cout << "L1 Norm of residual: ";
+    gmp_printf("%.4Fg\n", l1_norm.get_mpf_t());
+
+    // Verify correctness
+    mpf_class threshold(1, prec);
+    mpf_div_2exp(threshold.get_mpf_t(), threshold.get_mpf_t(), prec / 2);
+    if (l1_norm < threshold) {
+        std::cout << "Result OK" << std::endl;
+    } else {
+        std::cout << "Result NG" << std::endl;
+    }
+
+    // Clean up
+    delete[] x;
+    delete[] y;
+
+    return EXIT_SUCCESS;
+}
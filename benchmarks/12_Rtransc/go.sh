@@ -0,0 +1,93 @@
+#!/usr/bin/env bash
+#
+# Copyright (c) 2026
+#      Nakata, Maho
+#      All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions
+# are met:
+# 1. Redistributions of source code must retain the above copyright
+#    notice, this list of conditions and the following disclaimer.
+# 2. Redistributions in binary form must reproduce the above copyright
+#    notice, this list of conditions and the following disclaimer in the
+#    documentation and/or other materials provided with the distribution.
+#
+# THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+# ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+# ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+# OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+# HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+# LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+# OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+# SUCH DAMAGE.
+
+
+uname -a
+cat /proc/cpuinfo | grep 'model name' | head -1
+echo
+executables=(
+    "Rtransc_gmp_kernel_01_mkII"
+    "Rtransc_gmp_kernel_01_mkII_NOPRECCHANGE"
+    "Rtransc_gmp_kernel_openmp_01_mkII"
+    "Rtransc_gmp_kernel_openmp_01_mkII_NOPRECCHANGE"
+)
+for function in exp log sin atan tan sincos sin_cos; do
+    for prec in 128 256 512 1024 4096 16384; do
+        # Fewer arguments at high precision keep each run near a minute.
+        n=10000
+        if [ $prec -ge 16384 ]; then
+            n=100
+        elif [ $prec -ge 4096 ]; then
+            n=1000
+        fi
+        for exe in "${executables[@]}"; do
+            COMMAND_LINE="/usr/bin/time ./$exe $function $n $prec"
+            echo $COMMAND_LINE
+            $COMMAND_LINE
+            if [ -f gmon.out ]; then
+                mv gmon.out "gmon_${exe}_${function}_${prec}.out"
+                gprof ./$exe "gmon_${exe}_${function}_${prec}.out" > "gprof_${exe}_${function}_${prec}.txt"
+            fi
+            echo
+        done
+    done
+done
+# One argument at very high precision, where exp, sin and atan use binary
+# splitting.  The OpenMP variants then run its recursion on all threads.
+for function in exp sin atan; do
+    for prec in 100000 1000000 10000000; do
+        for exe in "${executables[@]}"; do
+            COMMAND_LINE="/usr/bin/time ./$exe $function 1 $prec"
+            echo $COMMAND_LINE
+            $COMMAND_LINE
+            echo
+        done
+    done
+done
+# pi by Gauss-Legendre and by the Chudnovsky series, then the Chudnovsky
+# series extended from 80% of the precision.
+pi_executables=(
+    "Rpi_gmp_kernel_01_mkII"
+    "Rpi_gmp_kernel_openmp_01_mkII"
+)
+for prec in 100000 1000000 10000000 100000000; do
+    for exe in "${pi_executables[@]}"; do
+        for method in agm chudnovsky; do
+            if [ $method = agm ] && [ $prec -ge 100000000 ]; then
+                continue
+            fi
+            COMMAND_LINE="/usr/bin/time ./$exe $method $prec"
+            echo $COMMAND_LINE
+            $COMMAND_LINE
+            echo
+        done
+        COMMAND_LINE="/usr/bin/time ./$exe chudnovsky $prec $((prec / 5 * 4))"
+        echo $COMMAND_LINE
+        $COMMAND_LINE
+        echo
+    done
+done
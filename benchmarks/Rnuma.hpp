@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2026
+ *      Nakata, Maho
+ *      All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ */
+
+#pragma once
+
+// First-touch placement for the OpenMP benchmark vectors.
+//
+// A page belongs to the NUMA node of the thread that first writes it.  When
+// the main thread builds and fills a vector, every limb ends up on one node,
+// and on a multi-socket host the other sockets' threads read remote memory
+// throughout the kernel.  The helpers below build and fill vectors inside a
+// parallel loop with the same static partition the kernel uses.  Each
+// element's limbs are then allocated and first written by the thread that
+// later reads them: glibc and most other mallocs give each thread its own
+// arena.
+//
+// chunk selects the partition: 0 is schedule(static), the contiguous
+// blocks that a plain `omp for` also gets from libgomp and libomp, and a
+// positive chunk is schedule(static, chunk).
+//
+// Rnuma_random derives each value from the seed and the index alone, so the
+// vectors are the same for every thread count and partition.  Thread
+// pinning is left to the OpenMP runtime: run_benchmarks.sh sets
+// OMP_PROC_BIND and OMP_PLACES when PIN_THREADS=1.
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <new>
+
+template <class Body> inline void Rnuma_for(int64_t n, int64_t chunk, Body body) {
+#if defined(_OPENMP)
+#pragma omp parallel
+#endif
+    {
+        if (chunk > 0) {
+#if defined(_OPENMP)
+#pragma omp for schedule(static, chunk)
+#endif
+            for (int64_t i = 0; i < n; ++i) {
+                body(i);
+            }
+        } else {
+#if defined(_OPENMP)
+#pragma omp for schedule(static)
+#endif
+            for (int64_t i = 0; i < n; ++i) {
+                body(i);
+            }
+        }
+    }
+}
+
+// SplitMix64 finalizer.
+inline uint64_t Rnuma_mix(uint64_t x) {
+    x += 0x9e3779b97f4a7c15ull;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+    return x ^ (x >> 31);
+}
+
+// rop := a uniform value in [0, 1) with the random limbs needed for prec
+// bits, from (seed, index).  The limbs are written in place.  As in
+// mpf_urandomb, no more limbs are written than rop holds, so an rop with
+// less than prec bits gets a value at its own precision.
+inline void Rnuma_random(mpf_ptr rop, uint64_t seed, int64_t index, mp_bitcnt_t prec) {
+    const uint64_t key = Rnuma_mix(seed ^ Rnuma_mix((uint64_t)index));
+    // rop has room for _mp_prec + 1 limbs
+    const mp_size_t limbs = std::min((mp_size_t)((prec + GMP_NUMB_BITS - 1) / GMP_NUMB_BITS), (mp_size_t)rop->_mp_prec + 1);
+    mp_limb_t *d = rop->_mp_d;
+    for (mp_size_t k = 0; k < limbs; ++k) {
+        d[k] = (mp_limb_t)Rnuma_mix(key + (uint64_t)k) & GMP_NUMB_MASK;
+    }
+    // Normalize: GMP wants nonzero limbs at both ends
+    mp_size_t low = 0, high = limbs;
+    mp_exp_t exp = 0;
+    while (high > 0 && d[high - 1] == 0) {
+        --high;
+        --exp;
+    }
+    while (low < high && d[low] == 0) {
+        ++low;
+    }
+    if (low > 0) {
+        std::memmove(d, d + low, sizeof(mp_limb_t) * (size_t)(high - low));
+    }
+    rop->_mp_size = (int)(high - low);
+    rop->_mp_exp = high > low ? exp : 0;
+}
+
+// n zero mpf_class values of prec bits, each constructed by the thread
+// that owns its index.
+inline mpf_class *Rnuma_new_mpf_class(int64_t n, int64_t chunk, mp_bitcnt_t prec) {
+    mpf_class *v = static_cast<mpf_class *>(::operator new[](sizeof(mpf_class) * (size_t)n));
+    Rnuma_for(n, chunk, [v, prec](int64_t i) { new (&v[i]) mpf_class(0, prec); });
+    return v;
+}
+
+inline void Rnuma_delete_mpf_class(mpf_class *v, int64_t n, int64_t chunk) {
+    Rnuma_for(n, chunk, [v](int64_t i) { v[i].~mpf_class(); });
+    ::operator delete[](v);
+}
+
+inline void Rnuma_fill_random(mpf_class *v, int64_t n, int64_t chunk, uint64_t seed, mp_bitcnt_t prec) {
+    Rnuma_for(n, chunk, [=](int64_t i) { Rnuma_random(v[i].get_mpf_t(), seed, i, prec); });
+}
+
+// mpf_init2 and Rnuma_random for each element of a raw mpf_t array.
+inline void Rnuma_init_random(mpf_t *v, int64_t n, int64_t chunk, uint64_t seed, mp_bitcnt_t prec) {
+    Rnuma_for(n, chunk, [=](int64_t i) {
+        mpf_init2(v[i], prec);
+        Rnuma_random(v[i], seed, i, prec);
+    });
+}
+
+inline void Rnuma_clear(mpf_t *v, int64_t n, int64_t chunk) {
+    Rnuma_for(n, chunk, [v](int64_t i) { mpf_clear(v[i]); });
+}
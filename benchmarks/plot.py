@@ -38,6 +38,8 @@ import matplotlib.pyplot as plt
 
 COMMAND_RE = re.compile(r"^COMMAND\s+(\w+)\s+(\w+)\s+(\S+)\s+(.*)$")
 MFLOPS_RE = re.compile(r"^MFLOPS:\s+([0-9.eE+-]+)")
+ELAPSED_RE = re.compile(r"^Elapsed time:\s+([0-9.eE+-]+)")
+WALL_RE = re.compile(r"^WALL_SECONDS\s+([0-9.eE+-]+)")
 PARAM_RE = re.compile(r"(\w+)=([^\s]+)")
 
 
@@ -60,6 +62,7 @@ def parse_log(path):
     params = {}
     rows = []
     current = None
+    elapsed = None
 
     for line in lines:
         if line.startswith("BENCHMARK_PARAMS "):
@@ -74,12 +77,25 @@ def parse_log(path):
                 "command": match.group(3),
                 "args": match.group(4),
             }
+            elapsed = None
+            continue
+
+        match = ELAPSED_RE.match(line)
+        if match:
+            elapsed = float(match.group(1))
             continue
 
         match = MFLOPS_RE.match(line)
-        if match and current is not None:
+        if match and current is not None and "mflops" not in current:
             current["mflops"] = float(match.group(1))
+            current["kernel_seconds"] = elapsed
             rows.append(current)
+            continue
+
+        # The wall time follows the program output of its command.
+        match = WALL_RE.match(line)
+        if match and current is not None:
+            current["wall_seconds"] = float(match.group(1))
             current = None
 
     return os_name, cpu_name, params, rows
@@ -144,6 +160,29 @@ def plot_kernel(rows, kernel, title_suffix, output_base, group_label):
     plt.close()
 
 
+def format_seconds(value):
+    return "-" if value is None else f"{value:.6g}"
+
+
+def write_times(rows, output_base, group_label):
+    """Writes kernel and wall seconds per run to a CSV file and stdout."""
+    if not rows:
+        return
+
+    with open(f"{output_base}_times.csv", "w", encoding="utf-8") as out:
+        out.write("kernel,variant,kernel_seconds,wall_seconds\n")
+        for row in rows:
+            out.write(f"{row['kernel']},{row['variant']},"
+                      f"{format_seconds(row.get('kernel_seconds'))},"
+                      f"{format_seconds(row.get('wall_seconds'))}\n")
+
+    print(f"{group_label} times (s): kernel, wall")
+    for row in rows:
+        print(f"  {row['kernel']:<14} {row['variant']:<44} "
+              f"{format_seconds(row.get('kernel_seconds')):>10} "
+              f"{format_seconds(row.get('wall_seconds')):>10}")
+
+
 def plot_summary(rows, title_suffix, output_base, group_label):
     if not rows:
         return
@@ -203,7 +242,13 @@ def main():
             group_rows = select_rows(rows, openmp)
             group_base = pathlib.Path(f"{output_base}_{suffix}")
             plot_summary(group_rows, title_suffix, group_base, group_label)
-            for kernel in ["Rdot", "Raxpy", "Rgemv", "Rgemm"]:
+            write_times(group_rows, group_base, group_label)
+            for kernel in ["Rdot", "Raxpy", "Rgemv", "Rgemm", "Rgetrf", "Rpotrf",
+                           "Rsytrf", "Rgeqrf", "Rtrsm", "Rsyrk",
+                           "Rspmv_banded", "Rspmv_random", "Rdixon",
+                           "Rsyev_N", "Rsyev_V", "Rgemm_ooc",
+                           "Rgetrf_ooc", "Rexp", "Rlog", "Rsin", "Ratan",
+                           "Rtan", "Rsincos"]:
                 plot_kernel(group_rows, kernel, title_suffix, group_base,
                             group_label)
 
@@ -40,6 +40,28 @@ rgemm_m="${7:-500}"
 rgemm_k="${8:-500}"
 rgemm_n="${9:-500}"
 output_dir="${10:-${script_dir}/results}"
+rgetrf_n="${11:-500}"
+rpotrf_n="${12:-${rgetrf_n}}"
+rgeqrf_m="${13:-1000}"
+rgeqrf_n="${14:-500}"
+rspmv_n="${15:-100000}"
+rspmv_nnz="${16:-16}"
+rdixon_n="${17:-100}"
+rdixon_bits="${18:-64}"
+rsyev_n="${19:-100}"
+rooc_n="${20:-${rgemm_n}}"
+rooc_tile="${21:-64}"
+rooc_tiles="${22:-16}"
+rtransc_n="${23:-10000}"
+
+# PIN_THREADS=1 binds each OpenMP thread to its own core, spread over the
+# sockets, unless OMP_PROC_BIND or OMP_PLACES is already set.  The OpenMP
+# benchmarks first-touch their vectors with the kernel's partition, so a
+# pinned thread keeps reading memory on its own node.
+if [[ "${PIN_THREADS:-0}" == 1 ]]; then
+    export OMP_PROC_BIND="${OMP_PROC_BIND:-spread}"
+    export OMP_PLACES="${OMP_PLACES:-cores}"
+fi
 
 mkdir -p "${output_dir}"
 log_file="${output_dir}/benchmark_$(date +%Y%m%d_%H%M%S).log"
@@ -65,7 +87,12 @@ run_one() {
     fi
 
     echo "COMMAND ${label} ${exe} $*"
-    /usr/bin/time -f "WALL_SECONDS %e" "${exe}" "$@"
+    # Wall time of the whole executable, beside the kernel's Elapsed time
+    python3 -c 'import subprocess, sys, time
+start = time.perf_counter()
+status = subprocess.call(sys.argv[1:])
+print(f"WALL_SECONDS {time.perf_counter() - start:.3f}", flush=True)
+sys.exit(status)' "${exe}" "$@"
     echo
 }
 
@@ -93,6 +120,14 @@ run_variants() {
             "Rdot_gmp_kernel_04_orig"
             "Rdot_gmp_kernel_04_mkII"
             "Rdot_gmp_kernel_04_mkII_NOPRECCHANGE"
+            "Rdot_gmp_kernel_05_mkII"
+            "Rdot_gmp_kernel_05_mkII_NOPRECCHANGE"
+            "Rdot_gmp_kernel_05_mkII_GENERIC_LIMBS"
+            "Rdot_gmp_kernel_06_mkII"
+            "Rdot_gmp_kernel_06_mkII_NOPRECCHANGE"
+            "Rdot_gmp_kernel_07_mkII"
+            "Rdot_gmp_kernel_07_mkII_NOPRECCHANGE"
+            "Rdot_gmp_kernel_07_mkII_BATCH_PORTABLE"
             "Rdot_gmp_kernel_openmp_01_orig"
             "Rdot_gmp_kernel_openmp_01_mkII"
             "Rdot_gmp_kernel_openmp_01_mkII_NOPRECCHANGE"
@@ -111,6 +146,12 @@ run_variants() {
             "Raxpy_gmp_kernel_02_orig"
             "Raxpy_gmp_kernel_02_mkII"
             "Raxpy_gmp_kernel_02_mkII_NOPRECCHANGE"
+            "Raxpy_gmp_kernel_03_mkII"
+            "Raxpy_gmp_kernel_03_mkII_NOPRECCHANGE"
+            "Raxpy_gmp_kernel_03_mkII_GENERIC_LIMBS"
+            "Raxpy_gmp_kernel_04_mkII"
+            "Raxpy_gmp_kernel_04_mkII_NOPRECCHANGE"
+            "Raxpy_gmp_kernel_04_mkII_BATCH_PORTABLE"
             "Raxpy_gmp_kernel_openmp_01_orig"
             "Raxpy_gmp_kernel_openmp_01_mkII"
             "Raxpy_gmp_kernel_openmp_01_mkII_NOPRECCHANGE"
@@ -152,6 +193,11 @@ run_variants() {
             "Rgemm_gmp_kernel_03_orig"
             "Rgemm_gmp_kernel_03_mkII"
             "Rgemm_gmp_kernel_03_mkII_NOPRECCHANGE"
+            "Rgemm_gmp_kernel_04_orig"
+            "Rgemm_gmp_kernel_04_mkII"
+            "Rgemm_gmp_kernel_04_mkII_NOPRECCHANGE"
+            "Rgemm_gmp_kernel_05_mkII"
+            "Rgemm_gmp_kernel_05_mkII_NOPRECCHANGE"
             "Rgemm_gmp_kernel_openmp_01_orig"
             "Rgemm_gmp_kernel_openmp_01_mkII"
             "Rgemm_gmp_kernel_openmp_01_mkII_NOPRECCHANGE"
@@ -161,12 +207,169 @@ run_variants() {
             "Rgemm_gmp_kernel_openmp_03_orig"
             "Rgemm_gmp_kernel_openmp_03_mkII"
             "Rgemm_gmp_kernel_openmp_03_mkII_NOPRECCHANGE"
+            "Rgemm_gmp_kernel_openmp_04_orig"
+            "Rgemm_gmp_kernel_openmp_04_mkII"
+            "Rgemm_gmp_kernel_openmp_04_mkII_NOPRECCHANGE"
+        )
+        ;;
+    Rgetrf)
+        executables=(
+            "Rgetrf_gmp_C_native_01"
+            "Rgetrf_gmp_C_native_openmp_01"
+            "Rgetrf_gmp_kernel_01_orig"
+            "Rgetrf_gmp_kernel_01_mkII"
+            "Rgetrf_gmp_kernel_01_mkII_NOPRECCHANGE"
+            "Rgetrf_gmp_kernel_02_orig"
+            "Rgetrf_gmp_kernel_02_mkII"
+            "Rgetrf_gmp_kernel_02_mkII_NOPRECCHANGE"
+            "Rgetrf_gmp_kernel_openmp_01_orig"
+            "Rgetrf_gmp_kernel_openmp_01_mkII"
+            "Rgetrf_gmp_kernel_openmp_01_mkII_NOPRECCHANGE"
+            "Rgetrf_gmp_kernel_03_mkII"
+            "Rgetrf_gmp_kernel_03_mkII_NOPRECCHANGE"
+            "Rgetrf_gmp_kernel_openmp_02_mkII"
+            "Rgetrf_gmp_kernel_openmp_02_mkII_NOPRECCHANGE"
+        )
+        ;;
+    Rpotrf)
+        executables=(
+            "Rpotrf_gmp_C_native_01"
+            "Rpotrf_gmp_C_native_openmp_01"
+            "Rpotrf_gmp_kernel_01_orig"
+            "Rpotrf_gmp_kernel_01_mkII"
+            "Rpotrf_gmp_kernel_01_mkII_NOPRECCHANGE"
+            "Rpotrf_gmp_kernel_02_orig"
+            "Rpotrf_gmp_kernel_02_mkII"
+            "Rpotrf_gmp_kernel_02_mkII_NOPRECCHANGE"
+            "Rpotrf_gmp_kernel_openmp_01_orig"
+            "Rpotrf_gmp_kernel_openmp_01_mkII"
+            "Rpotrf_gmp_kernel_openmp_01_mkII_NOPRECCHANGE"
+        )
+        ;;
+    Rsytrf)
+        executables=(
+            "Rsytrf_gmp_kernel_01_orig"
+            "Rsytrf_gmp_kernel_01_mkII"
+            "Rsytrf_gmp_kernel_01_mkII_NOPRECCHANGE"
+            "Rsytrf_gmp_kernel_02_orig"
+            "Rsytrf_gmp_kernel_02_mkII"
+            "Rsytrf_gmp_kernel_02_mkII_NOPRECCHANGE"
+            "Rsytrf_gmp_kernel_openmp_01_orig"
+            "Rsytrf_gmp_kernel_openmp_01_mkII"
+            "Rsytrf_gmp_kernel_openmp_01_mkII_NOPRECCHANGE"
+        )
+        ;;
+    Rgeqrf)
+        executables=(
+            "Rgeqrf_gmp_C_native_01"
+            "Rgeqrf_gmp_C_native_openmp_01"
+            "Rgeqrf_gmp_kernel_01_orig"
+            "Rgeqrf_gmp_kernel_01_mkII"
+            "Rgeqrf_gmp_kernel_01_mkII_NOPRECCHANGE"
+            "Rgeqrf_gmp_kernel_02_orig"
+            "Rgeqrf_gmp_kernel_02_mkII"
+            "Rgeqrf_gmp_kernel_02_mkII_NOPRECCHANGE"
+            "Rgeqrf_gmp_kernel_openmp_01_orig"
+            "Rgeqrf_gmp_kernel_openmp_01_mkII"
+            "Rgeqrf_gmp_kernel_openmp_01_mkII_NOPRECCHANGE"
+        )
+        ;;
+    Rtrsm)
+        executables=(
+            "Rtrsm_gmp_kernel_01_orig"
+            "Rtrsm_gmp_kernel_01_mkII"
+            "Rtrsm_gmp_kernel_01_mkII_NOPRECCHANGE"
+            "Rtrsm_gmp_kernel_02_orig"
+            "Rtrsm_gmp_kernel_02_mkII"
+            "Rtrsm_gmp_kernel_02_mkII_NOPRECCHANGE"
+            "Rtrsm_gmp_kernel_openmp_01_orig"
+            "Rtrsm_gmp_kernel_openmp_01_mkII"
+            "Rtrsm_gmp_kernel_openmp_01_mkII_NOPRECCHANGE"
+        )
+        ;;
+    Rsyrk)
+        executables=(
+            "Rsyrk_gmp_kernel_01_orig"
+            "Rsyrk_gmp_kernel_01_mkII"
+            "Rsyrk_gmp_kernel_01_mkII_NOPRECCHANGE"
+            "Rsyrk_gmp_kernel_02_orig"
+            "Rsyrk_gmp_kernel_02_mkII"
+            "Rsyrk_gmp_kernel_02_mkII_NOPRECCHANGE"
+            "Rsyrk_gmp_kernel_openmp_01_orig"
+            "Rsyrk_gmp_kernel_openmp_01_mkII"
+            "Rsyrk_gmp_kernel_openmp_01_mkII_NOPRECCHANGE"
+        )
+        ;;
+    Rspmv_banded|Rspmv_random)
+        executables=(
+            "Rspmv_gmp_C_native_01"
+            "Rspmv_gmp_C_native_openmp_01"
+            "Rspmv_gmp_kernel_01_orig"
+            "Rspmv_gmp_kernel_01_mkII"
+            "Rspmv_gmp_kernel_01_mkII_NOPRECCHANGE"
+            "Rspmv_gmp_kernel_02_mkII"
+            "Rspmv_gmp_kernel_02_mkII_NOPRECCHANGE"
+            "Rspmv_gmp_kernel_03_mkII"
+            "Rspmv_gmp_kernel_03_mkII_NOPRECCHANGE"
+            "Rspmv_gmp_kernel_openmp_01_mkII"
+            "Rspmv_gmp_kernel_openmp_01_mkII_NOPRECCHANGE"
+            "Rspmv_gmp_kernel_openmp_02_mkII"
+            "Rspmv_gmp_kernel_openmp_02_mkII_NOPRECCHANGE"
+        )
+        ;;
+    Rdixon)
+        executables=(
+            "Rdixon_gmp_kernel_01_orig"
+            "Rdixon_gmp_kernel_01_mkII"
+            "Rdixon_gmp_kernel_01_mkII_NOPRECCHANGE"
+            "Rdixon_gmp_kernel_02_mkII"
+            "Rdixon_gmp_kernel_02_mkII_NOPRECCHANGE"
+            "Rdixon_gmp_kernel_openmp_01_mkII"
+            "Rdixon_gmp_kernel_openmp_01_mkII_NOPRECCHANGE"
+        )
+        ;;
+    Rsyev_N|Rsyev_V)
+        executables=(
+            "Rsyev_gmp_kernel_01_orig"
+            "Rsyev_gmp_kernel_01_mkII"
+            "Rsyev_gmp_kernel_01_mkII_NOPRECCHANGE"
+            "Rsyev_gmp_kernel_02_orig"
+            "Rsyev_gmp_kernel_02_mkII"
+            "Rsyev_gmp_kernel_02_mkII_NOPRECCHANGE"
+            "Rsyev_gmp_kernel_03_orig"
+            "Rsyev_gmp_kernel_03_mkII"
+            "Rsyev_gmp_kernel_03_mkII_NOPRECCHANGE"
+            "Rsyev_gmp_kernel_openmp_01_orig"
+            "Rsyev_gmp_kernel_openmp_01_mkII"
+            "Rsyev_gmp_kernel_openmp_01_mkII_NOPRECCHANGE"
+        )
+        ;;
+    Rgemm_ooc)
+        executables=(
+            "Rgemm_ooc_gmp_C_native_01"
+            "Rgemm_ooc_gmp_C_native_02"
+            "Rgemm_ooc_gmp_C_native_openmp_01"
+        )
+        ;;
+    Rgetrf_ooc)
+        executables=(
+            "Rgetrf_ooc_gmp_C_native_01"
+            "Rgetrf_ooc_gmp_C_native_02"
+            "Rgetrf_ooc_gmp_C_native_openmp_01"
+        )
+        ;;
+    Rexp|Rlog|Rsin|Ratan|Rtan|Rsincos)
+        executables=(
+            "Rtransc_gmp_kernel_01_mkII"
+            "Rtransc_gmp_kernel_01_mkII_NOPRECCHANGE"
+            "Rtransc_gmp_kernel_openmp_01_mkII"
+            "Rtransc_gmp_kernel_openmp_01_mkII_NOPRECCHANGE"
         )
         ;;
     esac
 
     for exe in "${executables[@]}"; do
-        run_one "${kernel} ${exe#${kernel}_gmp_}" "${subdir}" "${exe}" "${args[@]}"
+        run_one "${kernel} ${exe#*_gmp_}" "${subdir}" "${exe}" "${args[@]}"
     done
 }
 
@@ -177,13 +380,32 @@ run_variants() {
     else
         uname -m
     fi
-    echo "BENCHMARK_PARAMS precision=${precision} rdot_n=${rdot_n} raxpy_n=${raxpy_n} rgemv_m=${rgemv_m} rgemv_n=${rgemv_n} rgemm_m=${rgemm_m} rgemm_k=${rgemm_k} rgemm_n=${rgemm_n}"
+    echo "BENCHMARK_PARAMS precision=${precision} rdot_n=${rdot_n} raxpy_n=${raxpy_n} rgemv_m=${rgemv_m} rgemv_n=${rgemv_n} rgemm_m=${rgemm_m} rgemm_k=${rgemm_k} rgemm_n=${rgemm_n} rgetrf_n=${rgetrf_n} rpotrf_n=${rpotrf_n} rgeqrf_m=${rgeqrf_m} rgeqrf_n=${rgeqrf_n} rspmv_n=${rspmv_n} rspmv_nnz=${rspmv_nnz} rdixon_n=${rdixon_n} rdixon_bits=${rdixon_bits} rsyev_n=${rsyev_n} rooc_n=${rooc_n} rooc_tile=${rooc_tile} rooc_tiles=${rooc_tiles} rtransc_n=${rtransc_n} omp_num_threads=${OMP_NUM_THREADS:-default} omp_proc_bind=${OMP_PROC_BIND:-unset} omp_places=${OMP_PLACES:-unset}"
     echo
 
     run_variants Rdot 00_Rdot "${rdot_n}" "${precision}"
     run_variants Raxpy 01_Raxpy "${raxpy_n}" "${precision}"
     run_variants Rgemv 02_Rgemv "${rgemv_m}" "${rgemv_n}" "${precision}"
     run_variants Rgemm 03_Rgemm "${rgemm_m}" "${rgemm_k}" "${rgemm_n}" "${precision}"
+    run_variants Rgetrf 04_Rgetrf "${rgetrf_n}" "${precision}"
+    run_variants Rpotrf 05_Rpotrf "${rpotrf_n}" "${precision}"
+    run_variants Rsytrf 05_Rpotrf "${rpotrf_n}" "${precision}"
+    run_variants Rgeqrf 06_Rgeqrf "${rgeqrf_m}" "${rgeqrf_n}" "${precision}"
+    run_variants Rtrsm 07_Rtrsm "${rgemm_m}" "${rgemm_n}" "${precision}"
+    run_variants Rsyrk 07_Rtrsm "${rgemm_m}" "${rgemm_k}" "${precision}"
+    run_variants Rspmv_banded 08_Rspmv banded "${rspmv_n}" "${rspmv_nnz}" "${precision}"
+    run_variants Rspmv_random 08_Rspmv random "${rspmv_n}" "${rspmv_nnz}" "${precision}"
+    run_variants Rdixon 09_Rdixon "${rdixon_n}" "${rdixon_bits}"
+    run_variants Rsyev_N 10_Rsyev N "${rsyev_n}" "${precision}"
+    run_variants Rsyev_V 10_Rsyev V "${rsyev_n}" "${precision}"
+    run_variants Rgemm_ooc 11_Rooc "${rooc_n}" "${rooc_tile}" "${rooc_tiles}" "${precision}"
+    run_variants Rgetrf_ooc 11_Rooc "${rooc_n}" "${rooc_tile}" "${rooc_tiles}" "${precision}"
+    run_variants Rexp 12_Rtransc exp "${rtransc_n}" "${precision}"
+    run_variants Rlog 12_Rtransc log "${rtransc_n}" "${precision}"
+    run_variants Rsin 12_Rtransc sin "${rtransc_n}" "${precision}"
+    run_variants Ratan 12_Rtransc atan "${rtransc_n}" "${precision}"
+    run_variants Rtan 12_Rtransc tan "${rtransc_n}" "${precision}"
+    run_variants Rsincos 12_Rtransc sincos "${rtransc_n}" "${precision}"
 } 2>&1 | tee "${log_file}"
 
 python3 "${script_dir}/plot.py" "${log_file}" --output-dir "${output_dir}"
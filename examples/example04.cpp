@@ -34,7 +34,9 @@
  * the number of correct digits when the working precision is high enough.
  * The example is useful for gmpxx_mkII because it stresses sqrt(), division,
  * expression-template temporaries, and repeated assignment at a fixed
- * precision.
+ * precision.  The library's const_pi() itself sums the Chudnovsky series by
+ * binary splitting, which is several times faster at high precision; the
+ * last line compares the two.
  *
  * First modern publications:
  *
@@ -102,6 +104,6 @@ int main() {
                   << ": " << pi << '\n';
     } while (iteration == 1 || gmpxx::abs(pi - previous_pi) > tolerance);
 
-    std::cout << "const_pi() result: " << gmpxx::const_pi(precision) << '\n';
+    std::cout << "const_pi() result (Chudnovsky): " << gmpxx::const_pi(precision) << '\n';
     return 0;
 }
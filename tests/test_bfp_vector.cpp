@@ -0,0 +1,237 @@
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include <gmpxx_mkII.h>
+
+namespace {
+
+constexpr mp_bitcnt_t test_prec = 256;
+
+std::vector<gmpxx::mpf_class> make_values(std::size_t n, double scale,
+                                          unsigned seed) {
+    std::vector<gmpxx::mpf_class> values;
+    values.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        gmpxx::mpf_class value(0, test_prec);
+        mpf_set_ui(value.get_mpf_t(), static_cast<unsigned long>(
+                                          (i * 2654435761u + seed) % 1000003u));
+        mpf_div_ui(value.get_mpf_t(), value.get_mpf_t(), 7919u + seed);
+        value *= scale;
+        if ((i + seed) % 3 == 0) {
+            value = -value;
+        }
+        values.push_back(value);
+    }
+    return values;
+}
+
+// |expected - actual| <= 2^-bits * magnitude
+void check_close(gmpxx::mpf_class const& expected,
+                 gmpxx::mpf_class const& actual,
+                 gmpxx::mpf_class const& magnitude, long bits) {
+    gmpxx::mpf_class error(expected - actual, test_prec);
+    error = abs(error);
+    gmpxx::mpf_class bound(magnitude, test_prec);
+    mpf_div_2exp(bound.get_mpf_t(), bound.get_mpf_t(),
+                 static_cast<mp_bitcnt_t>(bits));
+    assert(error <= bound);
+}
+
+void test_round_trip() {
+    std::vector<gmpxx::mpf_class> values = make_values(150, 3.0, 1);
+    values[5] = 0;
+    gmpxx::bfp_vector x(values, test_prec, 16);
+    assert(x.size() == values.size());
+    assert(x.block_size() == 16);
+    assert(x.block_count() == 10);
+    assert(x.get_prec() == test_prec);
+    assert(x.fraction_bits() >= test_prec);
+
+    gmpxx::mpf_class one(1, test_prec);
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        check_close(values[i], x.get(i), one * 1024, test_prec - 8);
+    }
+    assert(x.get(5) == 0);
+
+    std::vector<gmpxx::mpf_class> out = x.to_vector();
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        assert(out[i] == x.get(i));
+    }
+}
+
+void test_small_values_in_zero_block() {
+    gmpxx::bfp_vector x(8, test_prec, 4);
+    gmpxx::mpf_class tiny(1, test_prec);
+    mpf_div_2exp(tiny.get_mpf_t(), tiny.get_mpf_t(), 300);
+    tiny /= 3;
+    x.set(1, tiny);
+    check_close(tiny, x.get(1), tiny, test_prec - 2);
+
+    gmpxx::bfp_vector y(8, test_prec, 4);
+    y += x;
+    check_close(tiny, y.get(1), tiny, test_prec - 2);
+    assert(y.get(0) == 0);
+    assert(y.get(5) == 0);
+}
+
+void test_set_raises_block() {
+    std::vector<gmpxx::mpf_class> values = make_values(8, 1.0, 2);
+    gmpxx::bfp_vector x(values, test_prec, 4);
+    gmpxx::mpf_class big(1, test_prec);
+    mpf_mul_2exp(big.get_mpf_t(), big.get_mpf_t(), 40);
+    x.set(2, big);
+    assert(x.get(2) == big);
+    check_close(values[0], x.get(0), big, test_prec - 2);
+    check_close(values[6], x.get(6), gmpxx::mpf_class(1024, test_prec),
+                test_prec - 8);
+}
+
+void test_add() {
+    std::vector<gmpxx::mpf_class> a = make_values(100, 5.0, 3);
+    std::vector<gmpxx::mpf_class> b = make_values(100, 5.0, 4);
+    // Exact cancellation in one slot exercises the zero-magnitude path.
+    b[7] = -a[7];
+    gmpxx::bfp_vector x(a, test_prec, 32);
+    gmpxx::bfp_vector y(b, test_prec, 32);
+    y += x;
+    gmpxx::mpf_class magnitude(1024 * 1024, test_prec);
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        gmpxx::mpf_class expected(a[i] + b[i], test_prec);
+        check_close(expected, y.get(i), magnitude, test_prec - 8);
+    }
+    assert(y.get(7) == 0);
+}
+
+void test_axpy() {
+    std::vector<gmpxx::mpf_class> a = make_values(100, 1.0, 5);
+    std::vector<gmpxx::mpf_class> b = make_values(100, 1000.0, 6);
+    gmpxx::mpf_class alpha(-2.75, test_prec);
+    gmpxx::bfp_vector x(a, test_prec);
+    gmpxx::bfp_vector y(b, test_prec);
+    y.axpy(alpha, x);
+    gmpxx::mpf_class magnitude(1 << 30, test_prec);
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        gmpxx::mpf_class expected(b[i] + alpha * a[i], test_prec);
+        check_close(expected, y.get(i), magnitude, test_prec - 8);
+    }
+
+    gmpxx::bfp_vector unchanged(b, test_prec);
+    unchanged.axpy(gmpxx::mpf_class(0, test_prec), x);
+    for (std::size_t i = 0; i < b.size(); ++i) {
+        assert(unchanged.get(i) == gmpxx::bfp_vector(b, test_prec).get(i));
+    }
+}
+
+void test_dot() {
+    std::vector<gmpxx::mpf_class> a = make_values(300, 2.0, 7);
+    std::vector<gmpxx::mpf_class> b = make_values(300, 0.5, 8);
+    gmpxx::bfp_vector x(a, test_prec, 64);
+    gmpxx::bfp_vector y(b, test_prec, 64);
+
+    gmpxx::mpf_class expected(0, 2 * test_prec + 64);
+    gmpxx::mpf_class magnitude(0, test_prec);
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        expected += x.get(i) * y.get(i);
+        magnitude += abs(a[i] * b[i]);
+    }
+    gmpxx::mpf_class got = dot(x, y);
+    check_close(expected, got, magnitude, test_prec - 8);
+
+    gmpxx::bfp_vector zero(a.size(), test_prec, 64);
+    assert(dot(x, zero) == 0);
+}
+
+// 62, 126, 190, and 254 bits fill 1-4 limbs and take the inlined kernels;
+// the larger precisions take the generic mpn path.
+void test_limb_counts() {
+    const mp_bitcnt_t precisions[] = {30, 62, 100, 126, 190, 254, 256, 1000};
+    for (mp_bitcnt_t prec : precisions) {
+        std::vector<gmpxx::mpf_class> a = make_values(70, 3.0, 9);
+        std::vector<gmpxx::mpf_class> b = make_values(70, 3.0, 10);
+        b[3] = -a[3];
+        gmpxx::mpf_class alpha(1.5, test_prec);
+        gmpxx::bfp_vector x(a, prec, 16);
+        gmpxx::bfp_vector y(b, prec, 16);
+        gmpxx::bfp_vector z(b, prec, 16);
+        assert(x.limbs_per_element() * GMP_NUMB_BITS >= prec + 2);
+
+        gmpxx::mpf_class magnitude(1 << 20, test_prec);
+        // The references are computed at test_prec bits.
+        const long bits = static_cast<long>(std::min(prec, test_prec)) - 8;
+        gmpxx::mpf_class expected_dot(0, test_prec);
+        for (std::size_t i = 0; i < a.size(); ++i) {
+            expected_dot += a[i] * b[i];
+        }
+        check_close(expected_dot, dot(x, y), magnitude * 100, bits);
+
+        y += x;
+        z.axpy(alpha, x);
+        for (std::size_t i = 0; i < a.size(); ++i) {
+            gmpxx::mpf_class sum(a[i] + b[i], test_prec);
+            gmpxx::mpf_class scaled(b[i] + alpha * a[i], test_prec);
+            check_close(sum, y.get(i), magnitude, bits);
+            check_close(scaled, z.get(i), magnitude, bits);
+        }
+        assert(y.get(3) == 0);
+    }
+}
+
+void test_layout_mismatch() {
+    gmpxx::bfp_vector x(10, test_prec, 4);
+    gmpxx::bfp_vector y(10, test_prec, 8);
+    gmpxx::bfp_vector z(11, test_prec, 4);
+    bool thrown = false;
+    try {
+        x += y;
+    } catch (std::invalid_argument const&) {
+        thrown = true;
+    }
+    assert(thrown);
+    thrown = false;
+    try {
+        (void)dot(x, z);
+    } catch (std::invalid_argument const&) {
+        thrown = true;
+    }
+    assert(thrown);
+    thrown = false;
+    try {
+        x.set(10, gmpxx::mpf_class(1, test_prec));
+    } catch (std::out_of_range const&) {
+        thrown = true;
+    }
+    assert(thrown);
+    thrown = false;
+    try {
+        (void)x.get(10);
+    } catch (std::out_of_range const&) {
+        thrown = true;
+    }
+    assert(thrown);
+    thrown = false;
+    try {
+        gmpxx::bfp_vector bad(4, test_prec, 0);
+    } catch (std::invalid_argument const&) {
+        thrown = true;
+    }
+    assert(thrown);
+}
+
+}  // namespace
+
+int main() {
+    test_round_trip();
+    test_small_values_in_zero_block();
+    test_set_raises_block();
+    test_add();
+    test_axpy();
+    test_dot();
+    test_limb_counts();
+    test_layout_mismatch();
+    return 0;
+}
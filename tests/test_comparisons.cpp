@@ -29,10 +29,14 @@
 #include "gmpxx_mkII.h"
 
 #include <cassert>
+#include <climits>
 #include <cstdint>
 #include <limits>
+#include <stdexcept>
+#include <string>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace {
 
@@ -61,6 +65,26 @@ static_assert(comparison_pair<__uint128_t, mpq_class>);
 static_assert(!phase2_operand<__int128_t>);
 #endif
 
+// Values are compared in place; expressions are evaluated once and scalars are
+// normalized to the 64-bit leaf types, so long and long long reach the same
+// cmp_values overloads.
+template<class T>
+using materialized_t =
+    decltype(gmpxx_detail::materialize_for_cmp(std::declval<T const&>()));
+static_assert(std::same_as<materialized_t<mpf_class>, mpf_class const&>);
+static_assert(std::same_as<materialized_t<mpz_class>, mpz_class const&>);
+static_assert(std::same_as<materialized_t<mpq_class>, mpq_class const&>);
+static_assert(std::same_as<
+    materialized_t<decltype(std::declval<mpf_class>() + std::declval<mpf_class>())>,
+    mpf_class>);
+static_assert(std::same_as<materialized_t<int>, std::int64_t>);
+static_assert(std::same_as<materialized_t<long>, std::int64_t>);
+static_assert(std::same_as<materialized_t<long long>, std::int64_t>);
+static_assert(std::same_as<materialized_t<unsigned>, std::uint64_t>);
+static_assert(std::same_as<materialized_t<unsigned long>, std::uint64_t>);
+static_assert(std::same_as<materialized_t<unsigned long long>, std::uint64_t>);
+static_assert(std::same_as<materialized_t<float>, double>);
+
 template<class L, class R>
 void check_consistency(L const& lhs, R const& rhs) {
     int r = cmp(lhs, rhs);
@@ -145,6 +169,25 @@ void test_mpf_comparisons() {
     assert(zero == qzero);
     assert(!(zero != qzero));
 
+    // Integer and double scalars compare exactly against wide mpf values.
+    mpf_class wide(0.0, 256);
+    mpf_set_str(wide.get_mpf_t(), "18446744073709551616", 10);
+    assert(wide > std::numeric_limits<std::uint64_t>::max());
+    assert(std::numeric_limits<std::int64_t>::min() > -wide);
+    assert(-wide < std::numeric_limits<std::int64_t>::min());
+    mpf_class narrow(1.5, 64);
+    mpf_class just_below(1.5, 256);
+    mpf_class ulp(1.0, 256);
+    mpf_div_2exp(ulp.get_mpf_t(), ulp.get_mpf_t(), 200);
+    just_below -= ulp;
+    assert(just_below < narrow);
+    assert(just_below < 1.5);
+    assert(1.5 > just_below);
+    assert(just_below != 1.5);
+    check_consistency(just_below, narrow);
+    check_consistency(just_below, 1.5);
+    check_consistency(wide, std::numeric_limits<std::uint64_t>::max());
+
     check_consistency(f0, f1);
     check_consistency(f, z1);
     check_consistency(z1, f);
@@ -239,6 +282,136 @@ void test_scalar_comparisons() {
 #endif
 }
 
+void test_materialize_without_copy() {
+    mpf_class f(1.5, 256);
+    mpz_class z(std::int64_t{3});
+    mpq_class q("1/3");
+    assert(&gmpxx_detail::materialize_for_cmp(f) == &f);
+    assert(&gmpxx_detail::materialize_for_cmp(z) == &z);
+    assert(&gmpxx_detail::materialize_for_cmp(q) == &q);
+    mpf_class g(2.5, 256);
+    assert(gmpxx_detail::materialize_for_cmp(f + g) == 4);
+}
+
+// The mpf_cmp, mpf_cmp_si, mpf_cmp_ui, and mpf_cmp_d overloads must agree
+// with the exact mpq comparison of the generic cmp_values template.
+template<class S>
+void check_fast_path(mpf_class const& f, S scalar) {
+    const int fast = gmpxx_detail::cmp_values(f, scalar);
+    const int exact = gmpxx_detail::cmp_values<mpf_class, S>(f, scalar);
+    assert(fast == exact);
+    assert(gmpxx_detail::cmp_values(scalar, f) == -exact);
+    check_consistency(f, scalar);
+    check_consistency(scalar, f);
+}
+
+void test_mpf_fast_paths() {
+    const std::int64_t signed_values[] = {
+        0, 1, -1, 7, -7, LONG_MAX, LONG_MIN, LONG_MAX - 1, LONG_MIN + 1,
+        std::numeric_limits<std::int64_t>::max(),
+        std::numeric_limits<std::int64_t>::min()};
+    const std::uint64_t unsigned_values[] = {
+        0, 1, 7, ULONG_MAX, ULONG_MAX - 1,
+        std::numeric_limits<std::uint64_t>::max()};
+    const double double_values[] = {
+        0.0, -0.0, 1.0, -1.0, 0.1, -0.1, 1.5, 1e300, -1e300, 5e-324,
+        std::numeric_limits<double>::max(),
+        std::numeric_limits<double>::min()};
+
+    std::vector<mpf_class> values;
+    for (std::int64_t v : signed_values) {
+        mpf_class f(0.0, 256);
+        mpf_set_str(f.get_mpf_t(), std::to_string(v).c_str(), 10);
+        values.push_back(f);
+        mpf_class above = f;
+        mpf_class ulp(1.0, 256);
+        mpf_div_2exp(ulp.get_mpf_t(), ulp.get_mpf_t(), 180);
+        above += ulp;
+        values.push_back(above);
+    }
+    for (double v : double_values) {
+        mpf_class f(v, 256);
+        values.push_back(f);
+        mpf_class below(v, 256);
+        mpf_class ulp(1.0, 256);
+        mpf_div_2exp(ulp.get_mpf_t(), ulp.get_mpf_t(), 1200);
+        below -= ulp;
+        values.push_back(below);
+    }
+    for (mpf_class const& f : values) {
+        for (std::int64_t v : signed_values) {
+            check_fast_path(f, v);
+        }
+        for (std::uint64_t v : unsigned_values) {
+            check_fast_path(f, v);
+        }
+        for (double v : double_values) {
+            check_fast_path(f, v);
+        }
+        check_consistency(f, 0.1f);
+    }
+
+    // long and long long both reach the int64_t overload, so the results do
+    // not depend on which one int64_t names.
+    mpf_class f(0.0, 256);
+    mpf_set_str(f.get_mpf_t(), "9223372036854775807", 10);
+    assert(f == static_cast<long long>(LLONG_MAX));
+    assert(f > static_cast<long long>(LLONG_MAX - 1));
+    assert(-f > static_cast<long long>(LLONG_MIN));
+    assert(-f - 1 == static_cast<long long>(LLONG_MIN));
+    assert(cmp(f, LONG_MAX) == cmp(f, static_cast<long long>(LONG_MAX)));
+    assert(cmp(f, std::int64_t{-3}) == cmp(f, -3LL));
+    assert(cmp(f, std::numeric_limits<std::uint64_t>::max()) ==
+           cmp(f, static_cast<unsigned long long>(ULLONG_MAX)));
+    assert(f < static_cast<unsigned long long>(ULLONG_MAX));
+}
+
+// Every wrapper value is finite, so it lies between -inf and +inf on both
+// the mpf_cmp_d path and the exact mpq path.  NaN has no ordering and throws.
+void test_nonfinite_doubles() {
+    const double inf = std::numeric_limits<double>::infinity();
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    mpf_class f(0.0, 256);
+    mpf_set_str(f.get_mpf_t(), "1e1000000", 10);
+    mpz_class z("123456789012345678901234567890");
+    mpq_class q("-1/3");
+
+    assert(cmp(f, inf) < 0);
+    assert(cmp(f, -inf) > 0);
+    assert(cmp(inf, f) > 0);
+    assert(cmp(-inf, f) < 0);
+    assert(f < inf && -f > -inf);
+    assert(z < inf && z > -inf && inf > z);
+    assert(q < inf && q > -inf && -inf < q);
+    assert((f + f) < inf);
+    check_consistency(f, inf);
+    check_consistency(-inf, f);
+    check_consistency(z, -inf);
+    check_consistency(inf, q);
+
+    bool thrown = false;
+    try {
+        (void)cmp(f, nan);
+    } catch (std::domain_error const&) {
+        thrown = true;
+    }
+    assert(thrown);
+    thrown = false;
+    try {
+        (void)(nan < z);
+    } catch (std::domain_error const&) {
+        thrown = true;
+    }
+    assert(thrown);
+    thrown = false;
+    try {
+        (void)(q == nan);
+    } catch (std::domain_error const&) {
+        thrown = true;
+    }
+    assert(thrown);
+}
+
 void test_division_semantics() {
     mpz_class seven(std::int64_t{7});
     mpz_class two(std::int64_t{2});
@@ -264,6 +437,9 @@ int main() {
     test_mpf_comparisons();
     test_expression_comparisons();
     test_scalar_comparisons();
+    test_materialize_without_copy();
+    test_mpf_fast_paths();
+    test_nonfinite_doubles();
     test_division_semantics();
     test_precision_policy_interaction();
     return 0;
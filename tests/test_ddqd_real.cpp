@@ -0,0 +1,173 @@
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <cassert>
+#include <cfloat>
+#include <cmath>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+
+#include <gmpxx_mkII.h>
+
+namespace {
+
+constexpr mp_bitcnt_t reference_prec = 512;
+
+static_assert(std::is_same_v<gmpxx::tiered_float<53>, gmpxx::dd_real>);
+static_assert(std::is_same_v<gmpxx::tiered_float<106>, gmpxx::dd_real>);
+static_assert(std::is_same_v<gmpxx::tiered_float<107>, gmpxx::qd_real>);
+static_assert(std::is_same_v<gmpxx::tiered_float<212>, gmpxx::qd_real>);
+static_assert(std::is_same_v<gmpxx::tiered_float<213>, gmpxx::mpf_class>);
+
+// |expected - actual| <= 2^-bits * |expected|
+template<class T>
+void check_relative(gmpxx::mpf_class const& expected, T const& actual,
+                    long bits) {
+    gmpxx::mpf_class error(expected - actual.to_mpf(reference_prec),
+                           reference_prec);
+    error = abs(error);
+    gmpxx::mpf_class bound(abs(expected), reference_prec);
+    mpf_div_2exp(bound.get_mpf_t(), bound.get_mpf_t(),
+                 static_cast<mp_bitcnt_t>(bits));
+    assert(error <= bound);
+}
+
+// Random values with full-width low components and varied exponents.
+template<class T>
+T random_value(std::mt19937_64& rng) {
+    std::uniform_real_distribution<double> mantissa(-1.0, 1.0);
+    std::uniform_int_distribution<int> exponent(-40, 40);
+    gmpxx::mpf_class value(0, reference_prec);
+    gmpxx::mpf_class part(0, reference_prec);
+    mpf_set_d(value.get_mpf_t(), std::ldexp(mantissa(rng), exponent(rng)));
+    for (int i = 1; i < 5; ++i) {
+        mpf_set_d(part.get_mpf_t(), mantissa(rng));
+        mpf_div_2exp(part.get_mpf_t(), part.get_mpf_t(),
+                     static_cast<mp_bitcnt_t>(53 * i));
+        value += part * value;
+    }
+    return T(value);
+}
+
+template<class T>
+void test_arithmetic(long bits) {
+    std::mt19937_64 rng(11);
+    for (int i = 0; i < 2000; ++i) {
+        const T a = random_value<T>(rng);
+        const T b = random_value<T>(rng);
+        const gmpxx::mpf_class ma = a.to_mpf(reference_prec);
+        const gmpxx::mpf_class mb = b.to_mpf(reference_prec);
+
+        check_relative(gmpxx::mpf_class(ma * mb, reference_prec), a * b, bits);
+        check_relative(gmpxx::mpf_class(ma / mb, reference_prec), a / b, bits);
+        const gmpxx::mpf_class sum(ma + mb, reference_prec);
+        if (sum != 0) {
+            check_relative(sum, a + b, bits);
+        }
+        const gmpxx::mpf_class difference(ma - mb, reference_prec);
+        if (difference != 0) {
+            check_relative(difference, a - b, bits);
+        }
+        const T magnitude = abs(a);
+        check_relative(sqrt(magnitude.to_mpf(reference_prec)), sqrt(magnitude),
+                       bits);
+    }
+
+    // Cancellation keeps the error relative to the result.
+    const T one(1.0);
+    T tiny(1.0);
+    for (int i = 0; i < 3; ++i) {
+        tiny = tiny / T(1048576.0);
+    }
+    const T nearly = one + tiny;
+    check_relative(tiny.to_mpf(reference_prec), nearly - one, bits);
+    const T third = T(1.0) / T(3.0);
+    assert(third - third == T(0.0));
+}
+
+template<class T>
+void test_conversions_and_ordering(long bits) {
+    gmpxx::mpf_class third(1, reference_prec);
+    third /= 3;
+    const T converted(third);
+    check_relative(third, converted, bits);
+
+    // Construction from an mpf expression evaluates it first.
+    gmpxx::mpf_class two(2, reference_prec);
+    const T from_expr(two / gmpxx::mpf_class(3, reference_prec));
+    check_relative(gmpxx::mpf_class(two / 3, reference_prec), from_expr, bits);
+
+    const T small(third);
+    const T large = small + T(1e-30);
+    assert(small < large);
+    assert(large > small);
+    assert(small != large);
+    assert(small == T(third));
+    assert(-small < small);
+    assert(abs(-small) == small);
+
+    std::ostringstream out;
+    out.precision(20);
+    out << T(0.5);
+    assert(out.str() == "0.5");
+}
+
+template<class T>
+void test_transcendental(long bits) {
+    const mp_bitcnt_t work = T::digits + 32;
+    const T x = T(gmpxx::mpf_class(3, reference_prec) / 7);
+    const gmpxx::mpf_class mx = x.to_mpf(work);
+    check_relative(exp(mx), exp(x), bits);
+    check_relative(log(mx), log(x), bits);
+    check_relative(sin(mx), sin(x), bits);
+    check_relative(cos(mx), cos(x), bits);
+    check_relative(atan(mx), atan(x), bits);
+    check_relative(atan2(mx, exp(mx)), atan2(x, exp(x)), bits - 4);
+    check_relative(pow(mx, exp(mx)), pow(x, exp(x)), bits - 4);
+
+    bool thrown = false;
+    try {
+        (void)sqrt(T(-1.0));
+    } catch (std::domain_error const&) {
+        thrown = true;
+    }
+    assert(thrown);
+    assert(sqrt(T(0.0)) == T(0.0));
+}
+
+// Values outside the double range saturate like a double conversion.
+template<class T>
+void test_range() {
+    const T huge(gmpxx::mpf_class("1e400", 256));
+    assert(std::isinf(huge.get_d()) && huge.get_d() > 0);
+    const T negative_huge(gmpxx::mpf_class("-1e400", 256));
+    assert(std::isinf(negative_huge.get_d()) && negative_huge.get_d() < 0);
+    assert(T(gmpxx::mpf_class("1e-400", 256)) == T(0.0));
+    assert(T(gmpxx::mpf_class(DBL_MAX, 256)).get_d() == DBL_MAX);
+
+    assert(std::isinf(exp(T(1000.0)).get_d()));
+    assert(exp(T(-1000.0)) == T(0.0));
+
+    bool thrown = false;
+    try {
+        (void)huge.to_mpf();
+    } catch (std::domain_error const&) {
+        thrown = true;
+    }
+    assert(thrown);
+}
+
+}  // namespace
+
+int main() {
+    test_arithmetic<gmpxx::dd_real>(102);
+    test_arithmetic<gmpxx::qd_real>(205);
+    test_conversions_and_ordering<gmpxx::dd_real>(104);
+    test_conversions_and_ordering<gmpxx::qd_real>(208);
+    test_transcendental<gmpxx::dd_real>(102);
+    test_transcendental<gmpxx::qd_real>(205);
+    test_range<gmpxx::dd_real>();
+    test_range<gmpxx::qd_real>();
+    return 0;
+}
@@ -0,0 +1,359 @@
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <cassert>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include <gmpxx_mkII.h>
+
+namespace {
+
+using gmpxx::mpf_batch;
+using gmpxx::mpf_batch_kernel;
+using gmpxx::mpf_class;
+
+constexpr mpf_batch_kernel all_kernels[] = {
+    mpf_batch_kernel::portable, mpf_batch_kernel::avx2,
+    mpf_batch_kernel::avx512ifma};
+
+constexpr mp_bitcnt_t test_precs[] = {53, 64, 128, 200, 256, 512, 2048};
+
+// Values with mixed signs, exponents spread over [-160, 160) bits, and a
+// zero every eleventh element.
+std::vector<mpf_class> make_values(std::size_t n, mp_bitcnt_t prec,
+                                   unsigned long seed) {
+    gmp_randstate_t state;
+    gmp_randinit_default(state);
+    gmp_randseed_ui(state, seed);
+    std::vector<mpf_class> values;
+    values.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        mpf_class value(0, prec);
+        if ((i + seed) % 11 != 0) {
+            mpf_urandomb(value.get_mpf_t(), state, prec);
+            const long shift =
+                static_cast<long>((i * 2654435761u + seed * 40503u) % 320u) - 160;
+            if (shift >= 0) {
+                mpf_mul_2exp(value.get_mpf_t(), value.get_mpf_t(),
+                             static_cast<mp_bitcnt_t>(shift));
+            } else {
+                mpf_div_2exp(value.get_mpf_t(), value.get_mpf_t(),
+                             static_cast<mp_bitcnt_t>(-shift));
+            }
+            if ((i + seed) % 3 == 0) {
+                value = -value;
+            }
+        }
+        values.push_back(value);
+    }
+    gmp_randclear(state);
+    return values;
+}
+
+// |expected - actual| <= 2^-bits * magnitude
+void check_close(mpf_class const& expected, mpf_class const& actual,
+                 mpf_class const& magnitude, long bits) {
+    const mp_bitcnt_t prec = 2 * mpf_batch::max_prec + 128;
+    mpf_class error(0, prec);
+    mpf_sub(error.get_mpf_t(), expected.get_mpf_t(), actual.get_mpf_t());
+    mpf_abs(error.get_mpf_t(), error.get_mpf_t());
+    mpf_class bound(magnitude, prec);
+    mpf_abs(bound.get_mpf_t(), bound.get_mpf_t());
+    mpf_div_2exp(bound.get_mpf_t(), bound.get_mpf_t(),
+                 static_cast<mp_bitcnt_t>(bits));
+    assert(error <= bound);
+}
+
+mpf_class exact(mp_bitcnt_t prec) {
+    return mpf_class(0, 3 * prec + 512);
+}
+
+void test_round_trip(mpf_batch_kernel kernel, mp_bitcnt_t prec) {
+    const std::vector<mpf_class> values = make_values(37, prec, 1);
+    mpf_batch x(values, prec, kernel);
+    assert(x.size() == values.size());
+    assert(x.get_prec() == prec);
+    assert(x.kernel() == kernel);
+    assert(x.radix_bits() == (kernel == mpf_batch_kernel::avx512ifma ? 52u : 28u));
+    assert((x.digits_per_element() - 1) * x.radix_bits() >= prec);
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        check_close(values[i], x.get(i), values[i], static_cast<long>(prec));
+        assert((x.get(i) == 0) == (values[i] == 0));
+    }
+    std::vector<mpf_class> out = x.to_vector();
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        assert(out[i] == x.get(i));
+    }
+    x.set(3, values[4]);
+    assert(x.get(3) == x.get(4));
+}
+
+void test_add_mul_fma(mpf_batch_kernel kernel, mp_bitcnt_t prec) {
+    const std::size_t n = 45;
+    mpf_batch a(make_values(n, prec, 2), prec, kernel);
+    mpf_batch b(make_values(n, prec, 3), prec, kernel);
+    mpf_batch c(make_values(n, prec, 4), prec, kernel);
+    mpf_batch sum(n, prec, kernel);
+    mpf_batch product(n, prec, kernel);
+    mpf_batch fused(n, prec, kernel);
+    sum.add(a, b);
+    product.mul(a, b);
+    fused.fma(a, b, c);
+    const long bits = static_cast<long>(prec) - 2;
+    for (std::size_t i = 0; i < n; ++i) {
+        const mpf_class ai = a.get(i);
+        const mpf_class bi = b.get(i);
+        const mpf_class ci = c.get(i);
+        mpf_class s = exact(prec);
+        mpf_class p = exact(prec);
+        mpf_class f = exact(prec);
+        mpf_class magnitude = exact(prec);
+        mpf_add(s.get_mpf_t(), ai.get_mpf_t(), bi.get_mpf_t());
+        mpf_mul(p.get_mpf_t(), ai.get_mpf_t(), bi.get_mpf_t());
+        mpf_add(f.get_mpf_t(), p.get_mpf_t(), ci.get_mpf_t());
+        check_close(s, sum.get(i), s, bits);
+        check_close(p, product.get(i), p, bits);
+        mpf_abs(magnitude.get_mpf_t(), p.get_mpf_t());
+        mpf_class abs_c = abs(ci);
+        mpf_add(magnitude.get_mpf_t(), magnitude.get_mpf_t(), abs_c.get_mpf_t());
+        check_close(f, fused.get(i), magnitude, bits);
+    }
+}
+
+void test_cancellation_and_carry(mpf_batch_kernel kernel, mp_bitcnt_t prec) {
+    const std::size_t n = 8;
+    std::vector<mpf_class> lhs(n, mpf_class(0, prec));
+    std::vector<mpf_class> rhs(n, mpf_class(0, prec));
+    mpf_class third(1, prec);
+    third /= 3;
+    lhs[0] = third;            // exact cancellation
+    rhs[0] = -third;
+    lhs[1] = 0.75;             // carry out of the top digit
+    rhs[1] = 0.75;
+    lhs[2] = 1;                // operand far below the precision
+    mpf_div_2exp(rhs[2].get_mpf_t(), lhs[2].get_mpf_t(), 5000);
+    lhs[3] = 0.25;             // same exponent, larger negative operand
+    rhs[3] = -0.75;
+    lhs[4] = third;            // zero operands
+    lhs[5] = 1;                // 1 - 2^-40 cancels all but the last bits
+    mpf_div_2exp(rhs[5].get_mpf_t(), lhs[5].get_mpf_t(), 40);
+    rhs[5] = rhs[5] - 1;
+    lhs[6] = -2.5;
+    rhs[6] = 4;
+    mpf_batch a(lhs, prec, kernel);
+    mpf_batch b(rhs, prec, kernel);
+    mpf_batch r(n, prec, kernel);
+    r.add(a, b);
+    assert(r.get(0) == 0);
+    assert(r.get(1) == 1.5);
+    assert(r.get(2) == 1);
+    assert(r.get(3) == -0.5);
+    assert(r.get(4) == a.get(4));
+    assert(r.get(5) == b.get(5) + 1);
+    assert(r.get(6) == 1.5);
+    assert(r.get(7) == 0);
+    r.mul(a, b);
+    assert(r.get(1) == 0.5625);
+    assert(r.get(4) == 0);
+    assert(r.get(6) == -10);
+    assert(r.get(7) == 0);
+    r.fma(a, b, b);
+    assert(r.get(6) == -6);
+    assert(r.get(7) == 0);
+}
+
+void test_aliasing(mpf_batch_kernel kernel, mp_bitcnt_t prec) {
+    const std::vector<mpf_class> values = make_values(21, prec, 5);
+    mpf_batch x(values, prec, kernel);
+    const mpf_batch original = x;
+    x.add(x, x);
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        assert(x.get(i) == 2 * original.get(i));
+    }
+    x = original;
+    x.fma(x, x, x);
+    mpf_batch expected(values.size(), prec, kernel);
+    expected.fma(original, original, original);
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        assert(x.get(i) == expected.get(i));
+    }
+}
+
+void test_axpy_and_dot(mpf_batch_kernel kernel, mp_bitcnt_t prec) {
+    const std::size_t n = 203;
+    const std::vector<mpf_class> xs = make_values(n, prec, 6);
+    const std::vector<mpf_class> ys = make_values(n, prec, 7);
+    mpf_batch x(xs, prec, kernel);
+    mpf_batch y(ys, prec, kernel);
+    mpf_class alpha(-7, prec);
+    alpha /= 3;
+    mpf_batch z = y;
+    z.axpy(alpha, x);
+    mpf_batch alphas(n, prec, kernel);
+    alphas.fill(alpha);
+    const mpf_class stored_alpha = alphas.get(n - 1);
+    mpf_class magnitude = exact(prec);
+    mpf_class reference = exact(prec);
+    for (std::size_t i = 0; i < n; ++i) {
+        const mpf_class xi = x.get(i);
+        const mpf_class yi = y.get(i);
+        mpf_class expected = exact(prec);
+        mpf_class bound = exact(prec);
+        mpf_mul(expected.get_mpf_t(), stored_alpha.get_mpf_t(), xi.get_mpf_t());
+        mpf_abs(bound.get_mpf_t(), expected.get_mpf_t());
+        mpf_class abs_y = abs(yi);
+        mpf_add(bound.get_mpf_t(), bound.get_mpf_t(), abs_y.get_mpf_t());
+        mpf_add(expected.get_mpf_t(), expected.get_mpf_t(), yi.get_mpf_t());
+        check_close(expected, z.get(i), bound, static_cast<long>(prec) - 2);
+
+        mpf_class term = exact(prec);
+        mpf_mul(term.get_mpf_t(), xi.get_mpf_t(), yi.get_mpf_t());
+        mpf_add(reference.get_mpf_t(), reference.get_mpf_t(), term.get_mpf_t());
+        mpf_abs(term.get_mpf_t(), term.get_mpf_t());
+        mpf_add(magnitude.get_mpf_t(), magnitude.get_mpf_t(), term.get_mpf_t());
+    }
+    // One truncation per product and per level of the folding tree.
+    check_close(reference, dot(x, y), magnitude, static_cast<long>(prec) - 12);
+    assert(dot(mpf_batch(0, prec, kernel), mpf_batch(0, prec, kernel)) == 0);
+
+    // fill leaves the padding elements zero, so they add nothing to dot.
+    mpf_class filled = exact(prec);
+    mpf_mul(filled.get_mpf_t(), stored_alpha.get_mpf_t(), stored_alpha.get_mpf_t());
+    mpf_mul_ui(filled.get_mpf_t(), filled.get_mpf_t(), n);
+    check_close(filled, dot(alphas, alphas), filled, static_cast<long>(prec) - 12);
+}
+
+// Long batches are multiplied and accumulated in chunks.
+void test_chunked_dot(mpf_batch_kernel kernel, mp_bitcnt_t prec) {
+    const std::size_t n = 1100;
+    const std::vector<mpf_class> xs = make_values(n, prec, 8);
+    const std::vector<mpf_class> ys = make_values(n, prec, 9);
+    mpf_batch x(xs, prec, kernel);
+    mpf_batch y(ys, prec, kernel);
+    mpf_class magnitude = exact(prec);
+    mpf_class reference = exact(prec);
+    for (std::size_t i = 0; i < n; ++i) {
+        mpf_class term = exact(prec);
+        const mpf_class xi = x.get(i);
+        const mpf_class yi = y.get(i);
+        mpf_mul(term.get_mpf_t(), xi.get_mpf_t(), yi.get_mpf_t());
+        mpf_add(reference.get_mpf_t(), reference.get_mpf_t(), term.get_mpf_t());
+        mpf_abs(term.get_mpf_t(), term.get_mpf_t());
+        mpf_add(magnitude.get_mpf_t(), magnitude.get_mpf_t(), term.get_mpf_t());
+    }
+    check_close(reference, dot(x, y), magnitude, static_cast<long>(prec) - 12);
+}
+
+// AVX2 uses the portable kernel's radix and must agree with it bit for bit.
+void test_avx2_matches_portable(mp_bitcnt_t prec) {
+    if (!gmpxx::mpf_batch_kernel_supported(mpf_batch_kernel::avx2)) {
+        return;
+    }
+    const std::size_t n = 64;
+    const std::vector<mpf_class> as = make_values(n, prec, 8);
+    const std::vector<mpf_class> bs = make_values(n, prec, 9);
+    mpf_batch pa(as, prec, mpf_batch_kernel::portable);
+    mpf_batch pb(bs, prec, mpf_batch_kernel::portable);
+    mpf_batch va(as, prec, mpf_batch_kernel::avx2);
+    mpf_batch vb(bs, prec, mpf_batch_kernel::avx2);
+    mpf_batch pr(n, prec, mpf_batch_kernel::portable);
+    mpf_batch vr(n, prec, mpf_batch_kernel::avx2);
+    pr.add(pa, pb);
+    vr.add(va, vb);
+    for (std::size_t i = 0; i < n; ++i) {
+        assert(pr.get(i) == vr.get(i));
+    }
+    pr.fma(pa, pb, pa);
+    vr.fma(va, vb, va);
+    for (std::size_t i = 0; i < n; ++i) {
+        assert(pr.get(i) == vr.get(i));
+    }
+}
+
+void test_errors() {
+    bool thrown = false;
+    try {
+        mpf_batch too_wide(4, mpf_batch::max_prec + 1);
+    } catch (std::invalid_argument const&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    mpf_batch a(4, 128, mpf_batch_kernel::portable);
+    mpf_batch b(5, 128, mpf_batch_kernel::portable);
+    mpf_batch c(4, 192, mpf_batch_kernel::portable);
+    for (mpf_batch const* other : {&b, &c}) {
+        thrown = false;
+        try {
+            a.add(a, *other);
+        } catch (std::invalid_argument const&) {
+            thrown = true;
+        }
+        assert(thrown);
+    }
+    if (gmpxx::mpf_batch_kernel_supported(mpf_batch_kernel::avx2)) {
+        mpf_batch d(4, 128, mpf_batch_kernel::avx2);
+        thrown = false;
+        try {
+            a.mul(a, d);
+        } catch (std::invalid_argument const&) {
+            thrown = true;
+        }
+        assert(thrown);
+    }
+    for (mpf_batch_kernel kernel : all_kernels) {
+        if (gmpxx::mpf_batch_kernel_supported(kernel)) {
+            continue;
+        }
+        thrown = false;
+        try {
+            mpf_batch unsupported(4, 128, kernel);
+        } catch (std::invalid_argument const&) {
+            thrown = true;
+        }
+        assert(thrown);
+    }
+
+    thrown = false;
+    try {
+        (void)a.get(4);
+    } catch (std::out_of_range const&) {
+        thrown = true;
+    }
+    assert(thrown);
+    thrown = false;
+    try {
+        a.set(4, mpf_class(1, 128));
+    } catch (std::out_of_range const&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    mpf_batch automatic(4, 128);
+    assert(automatic.kernel() != mpf_batch_kernel::automatic);
+    assert(gmpxx::mpf_batch_kernel_supported(automatic.kernel()));
+}
+
+}  // namespace
+
+int main() {
+    for (mpf_batch_kernel kernel : all_kernels) {
+        if (!gmpxx::mpf_batch_kernel_supported(kernel)) {
+            continue;
+        }
+        for (mp_bitcnt_t prec : test_precs) {
+            test_round_trip(kernel, prec);
+            test_add_mul_fma(kernel, prec);
+            test_cancellation_and_carry(kernel, prec);
+            test_aliasing(kernel, prec);
+            test_axpy_and_dot(kernel, prec);
+            test_chunked_dot(kernel, prec);
+        }
+    }
+    for (mp_bitcnt_t prec : test_precs) {
+        test_avx2_matches_portable(prec);
+    }
+    test_errors();
+    return 0;
+}
@@ -88,6 +88,20 @@ void test_compile_time_surface() {
     static_assert(std::same_as<decltype(two_pi()), mpf_class>);
     static_assert(std::same_as<decltype(two_pi(std::declval<mp_bitcnt_t>())),
                                mpf_class>);
+    static_assert(std::same_as<decltype(const_sqrt2()), mpf_class>);
+    static_assert(std::same_as<
+                  decltype(sqrt_two(std::declval<mp_bitcnt_t>())), mpf_class>);
+    static_assert(std::same_as<decltype(const_euler()), mpf_class>);
+    static_assert(std::same_as<
+                  decltype(euler_gamma(std::declval<mp_bitcnt_t>())),
+                  mpf_class>);
+    static_assert(std::same_as<decltype(const_catalan()), mpf_class>);
+    static_assert(std::same_as<
+                  decltype(catalan(std::declval<mp_bitcnt_t>())), mpf_class>);
+    static_assert(std::same_as<decltype(const_zeta3()), mpf_class>);
+    static_assert(std::same_as<
+                  decltype(zeta_three(std::declval<mp_bitcnt_t>())),
+                  mpf_class>);
 
     static_assert(std::same_as<decltype(asin(std::declval<mpf_class const&>())),
                                mpf_class>);
@@ -170,6 +184,60 @@ void test_constants() {
     assert(two_pi().get_prec() == gmpxx_defaults::get_default_prec());
 }
 
+mpf_class decimal(char const* text, mp_bitcnt_t prec) {
+    mpf_class value(0, prec);
+    const int rc = mpf_set_str(value.get_mpf_t(), text, 10);
+    assert(rc == 0);
+    (void)rc;
+    return value;
+}
+
+void test_series_constants() {
+    // Reference digits, and agreement of each constant with itself at a
+    // higher precision, where the series take more terms.
+    const mp_bitcnt_t prec = 192;
+    assert_close(sqrt_two(prec),
+                 decimal("1.41421356237309504880168872420969807856967187537694",
+                         prec),
+                 160);
+    assert_close(euler_gamma(prec),
+                 decimal("0.57721566490153286060651209008240243104215933593992",
+                         prec),
+                 160);
+    assert_close(catalan(prec),
+                 decimal("0.91596559417721901505460351493238411077414937428167",
+                         prec),
+                 160);
+    assert_close(zeta_three(prec),
+                 decimal("1.20205690315959428539973816151144999076498629234049",
+                         prec),
+                 160);
+    assert(const_euler().get_prec() == gmpxx_defaults::get_default_prec());
+    assert(const_catalan().get_prec() == gmpxx_defaults::get_default_prec());
+    assert(const_zeta3().get_prec() == gmpxx_defaults::get_default_prec());
+    assert(const_sqrt2().get_prec() == gmpxx_defaults::get_default_prec());
+
+    for (mp_bitcnt_t low : {mp_bitcnt_t{64}, mp_bitcnt_t{3000}}) {
+        const mp_bitcnt_t high = 3 * low;
+        assert_close(const_euler(low), euler_gamma(high), low - 4);
+        assert_close(const_catalan(low), catalan(high), low - 4);
+        assert_close(const_zeta3(low), zeta_three(high), low - 4);
+        assert_close(const_sqrt2(low) * const_sqrt2(low), mpf_class(2, low),
+                     low - 4);
+    }
+
+    // log10, exp10 and inv_log_two read log 10 and log 2 from the cache.
+    namespace detail = gmpxx_transcendent_detail;
+    const mpf_class x = decimal("123.456", prec);
+    assert_close(log10(x), log(x) / log(mpf_class(10, prec)), 180);
+    assert_close(exp10(log10(x)), x, 170);
+    assert(detail::log_ten_cache().cached_precision() > prec);
+    assert_close(inv_log_two(prec),
+                 mpf_class(1, prec) / log(mpf_class(2, prec)), 180);
+    assert(detail::constant_cache(detail::cached_constant::inv_log_two)
+               .cached_precision() >= prec);
+}
+
 void test_inverse_trig() {
     const mp_bitcnt_t prec = 192;
     const mpf_class zero(0, prec);
@@ -306,6 +374,7 @@ void test_precision_policy() {
 int main() {
     test_compile_time_surface();
     test_constants();
+    test_series_constants();
     test_inverse_trig();
     test_hyperbolic();
     test_inverse_hyperbolic();
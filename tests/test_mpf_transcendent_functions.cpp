@@ -29,10 +29,22 @@
 #include "gmpxx_mkII.h"
 
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <concepts>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <future>
+#include <memory>
 #include <stdexcept>
+#include <string>
 #include <utility>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#endif
 
 namespace {
 
@@ -158,6 +170,9 @@ void test_compile_time_surface() {
                                mpf_class>);
     static_assert(std::same_as<decltype(tan(std::declval<mpf_class const&>())),
                                mpf_class>);
+    static_assert(std::same_as<
+                  decltype(sincos(std::declval<mpf_class const&>())),
+                  std::pair<mpf_class, mpf_class>>);
     static_assert(std::same_as<decltype(atan(std::declval<mpf_class const&>())),
                                mpf_class>);
     static_assert(std::same_as<
@@ -181,6 +196,8 @@ void test_compile_time_surface() {
                                mpf_class>);
     static_assert(std::same_as<decltype(tan(std::declval<expr_type>())),
                                mpf_class>);
+    static_assert(std::same_as<decltype(sincos(std::declval<expr_type>())),
+                               std::pair<mpf_class, mpf_class>>);
     static_assert(std::same_as<decltype(atan(std::declval<expr_type>())),
                                mpf_class>);
     static_assert(std::same_as<
@@ -464,6 +481,20 @@ void test_trig_reduction_and_atan2_axes() {
     assert_within_ulp(atan2(one, zero), pio2, prec, 1);
     assert_within_ulp(atan2(-one, zero), -pio2, prec, 1);
     assert_within_ulp(atan2(zero, zero), zero, prec, 1);
+
+    // sincos shares one reduction and returns what sin and cos return; tan
+    // divides the same pair.
+    for (char const* text : {"0.3", "-2.5", "1e-25", "1000.75"}) {
+        mpf_class y = parse_decimal_literal(text, prec);
+        auto [sin_y, cos_y] = sincos(y);
+        assert(sin_y == sin(y));
+        assert(cos_y == cos(y));
+        assert(sin_y.get_prec() == y.get_prec());
+        assert_within_ulp(tan(y), sin_y / cos_y, prec, 4);
+    }
+    auto [sin_sum, cos_sum] = sincos(x + one);
+    assert(sin_sum == sin(mpf_class(x + one)));
+    assert(cos_sum == cos(mpf_class(x + one)));
 }
 
 void test_pow_integer_and_domain_cases() {
@@ -537,6 +568,381 @@ void test_domain_errors() {
     assert(threw);
 }
 
+void test_high_precision_series() {
+    // Thousands of series terms, summed in rectangular blocks whose
+    // precision drops with the size of their terms.
+    assert_precision_doubling(exp, "0.3", 4096, 8192);
+    assert_precision_doubling(expm1, "-0.4", 4096, 8192);
+    assert_precision_doubling(log1p, "0.45", 4096, 8192);
+    assert_precision_doubling(sin, "0.7", 4096, 8192, 4);
+    assert_precision_doubling(cos, "0.7", 4096, 8192, 4);
+    assert_precision_doubling(atan, "0.49", 4096, 8192, 4);
+
+    mp_bitcnt_t prec = static_cast<mp_bitcnt_t>(8192);
+    mpf_class one(1, prec);
+    mpf_class x = parse_decimal_literal("2.71", prec);
+    assert_close(exp(x) * exp(-x), one, 8180);
+    assert_close(sin(x) * sin(x) + cos(x) * cos(x), one, 8180);
+
+    // expm1 keeps its relative accuracy between 2^-(prec/2) and 1/2, and
+    // log1p hands large arguments to log.
+    mp_bitcnt_t low = static_cast<mp_bitcnt_t>(256);
+    mpf_class tiny = two_to_minus(100, low);
+    mpf_class tiny2 = tiny * tiny;
+    assert_within_ulp(expm1(tiny), tiny + tiny2 / 2 + (tiny2 * tiny) / 6, low, 2);
+    mpf_class big(1000, low);
+    assert_within_ulp(log1p(big), log(big + 1), low, 2);
+}
+
+void test_argument_halving() {
+    // exp and sincos halve the reduced argument before the series and
+    // double back.  Results must match the same call at twice the
+    // precision, at arguments far above, near, and below the point where
+    // halving stops.
+    for (char const* x : {"0.34", "-0.34", "0.0625", "-0.001", "1e-12"}) {
+        for (mp_bitcnt_t prec : {mp_bitcnt_t{64}, mp_bitcnt_t{256},
+                                 mp_bitcnt_t{1024}, mp_bitcnt_t{4096}}) {
+            assert_precision_doubling(exp, x, prec, 2 * prec);
+            assert_precision_doubling(expm1, x, prec, 2 * prec);
+            assert_precision_doubling(sin, x, prec, 2 * prec);
+            assert_precision_doubling(cos, x, prec, 2 * prec);
+        }
+    }
+
+    // Halving count grows with precision and stops for small arguments.
+    using gmpxx_transcendent_detail::argument_halvings;
+    mpf_class x = parse_decimal_literal("0.34", 4096);
+    assert(argument_halvings(x.get_mpf_t(), 256, 1) > 0);
+    assert(argument_halvings(x.get_mpf_t(), 4096, 1) >
+           argument_halvings(x.get_mpf_t(), 256, 1));
+    assert(argument_halvings(x.get_mpf_t(), 4096, 2) <
+           argument_halvings(x.get_mpf_t(), 4096, 1));
+    mpf_class tiny = two_to_minus(200, 4096);
+    assert(argument_halvings(tiny.get_mpf_t(), 4096, 1) == 0);
+
+    // cos is rebuilt as 1 - v from the doubled versine v = 1 - cos, which
+    // must not lose the bits that cos(t) near 1 would round away.
+    mp_bitcnt_t prec = static_cast<mp_bitcnt_t>(1024);
+    mpf_class small = parse_decimal_literal("0.03", prec);
+    mpf_class one(1, 2 * prec);
+    mpf_class small_high = parse_decimal_literal("0.03", 2 * prec);
+    mpf_class versine_high = one - cos(small_high);
+    mpf_class one_low(1, prec);
+    mpf_class versine_low = one_low - cos(small);
+    mpf_class rounded(0, prec);
+    mpf_set(rounded.get_mpf_t(), versine_high.get_mpf_t());
+    assert_close(versine_low, rounded, prec + 8);
+}
+
+void test_log_tables() {
+    // Table-driven exp, expm1, log and log1p agree with the untabled
+    // kernels, and the tables respect their memory budget.
+    gmpxx_transcendental_tables::clear();
+    mpf_class const untabled = exp(parse_decimal_literal("-0.34", 128));
+    char const* arguments[] = {"0.3", "-0.34", "2.5", "-7.75", "0.001", "-0.45"};
+    char const* positive[] = {"0.3", "0.999", "1.0004", "2.5", "7.75", "1e-9", "123456.5"};
+    for (mp_bitcnt_t prec : {mp_bitcnt_t{128}, mp_bitcnt_t{1024}}) {
+        std::vector<mpf_class> cold;
+        for (char const* x : arguments) {
+            mpf_class value = parse_decimal_literal(x, prec);
+            cold.push_back(exp(value));
+            cold.push_back(expm1(value));
+            cold.push_back(log1p(value < -1 ? -value : value));
+        }
+        for (char const* x : positive) {
+            cold.push_back(log(parse_decimal_literal(x, prec)));
+        }
+
+        assert(gmpxx_transcendental_tables::warm_up(prec));
+        std::size_t i = 0;
+        for (char const* x : arguments) {
+            mpf_class value = parse_decimal_literal(x, prec);
+            assert_within_ulp(exp(value), cold[i++], prec, 2);
+            assert_within_ulp(expm1(value), cold[i++], prec, 2);
+            assert_within_ulp(log1p(value < -1 ? -value : value), cold[i++], prec, 2);
+        }
+        for (char const* x : positive) {
+            assert_within_ulp(log(parse_decimal_literal(x, prec)), cold[i++], prec, 2);
+        }
+    }
+    assert(gmpxx_transcendental_tables::table_count() == 2);
+    assert_precision_doubling(log, "3.75", 1024, 2048);
+    assert_precision_doubling(exp, "-3.75", 1024, 2048);
+
+    // A budget that holds only one table keeps the one used last.
+    std::size_t const default_budget =
+        gmpxx_transcendental_tables::get_memory_budget();
+    std::size_t const both = gmpxx_transcendental_tables::reserved_bytes();
+    (void)exp(parse_decimal_literal("0.5", 128));
+    gmpxx_transcendental_tables::set_memory_budget(both - 1);
+    assert(gmpxx_transcendental_tables::table_count() == 1);
+    assert(gmpxx_transcendental_tables::reserved_bytes() < both);
+    assert(gmpxx_transcendent_detail::log_tables().find(
+               gmpxx_transcendent_detail::log_table_precision(128)) != nullptr);
+
+    gmpxx_transcendental_tables::set_memory_budget(0);
+    assert(gmpxx_transcendental_tables::table_count() == 0);
+    assert(!gmpxx_transcendental_tables::warm_up(128));
+    assert_within_ulp(exp(parse_decimal_literal("-0.34", 128)), untabled, 128, 2);
+    gmpxx_transcendental_tables::set_memory_budget(default_budget);
+
+    // Without warm_up a precision gets its table after as many calls as the
+    // table has entries.
+    mpf_class x = parse_decimal_literal("0.7", 64);
+    std::size_t calls = 0;
+    while (gmpxx_transcendental_tables::table_count() == 0) {
+        (void)exp(x);
+        ++calls;
+        assert(calls <= 4096);
+    }
+    assert(calls > 1);
+    gmpxx_transcendental_tables::clear();
+}
+
+void test_log_tables_release() {
+    // Evicting a table frees it once no call holds it.  The table a thread
+    // used last does not keep it alive.
+    namespace detail = gmpxx_transcendent_detail;
+    mp_bitcnt_t const prec = 256;
+    detail::precision_type const table_prec = detail::log_table_precision(prec);
+    gmpxx_transcendental_tables::clear();
+    bool const built = gmpxx_transcendental_tables::warm_up(prec);
+    assert(built);
+    std::weak_ptr<detail::log_table> table = detail::log_tables().find(table_prec);
+    assert(!table.expired());
+    mpf_class const exp_value = exp(parse_decimal_literal("0.3", prec));
+    mpf_class const log_value = log(parse_decimal_literal("2.5", prec));
+    assert(detail::log_tables().find(table_prec) == table.lock());
+    gmpxx_transcendental_tables::clear();
+    assert(table.expired());
+    assert(gmpxx_transcendental_tables::reserved_bytes() == 0);
+
+    // The same through a budget too small for the table.
+    std::size_t const default_budget =
+        gmpxx_transcendental_tables::get_memory_budget();
+    bool const rebuilt = gmpxx_transcendental_tables::warm_up(prec);
+    assert(rebuilt);
+    table = detail::log_tables().find(table_prec);
+    assert_within_ulp(exp(parse_decimal_literal("0.3", prec)), exp_value, prec, 2);
+    gmpxx_transcendental_tables::set_memory_budget(0);
+    assert(table.expired());
+    assert_within_ulp(log(parse_decimal_literal("2.5", prec)), log_value, prec, 2);
+    gmpxx_transcendental_tables::set_memory_budget(default_budget);
+    gmpxx_transcendental_tables::clear();
+}
+
+void test_binary_splitting() {
+    // Bit-burst binary splitting agrees with the series kernels it
+    // replaces at very high precision, including tiny arguments, whose
+    // fixed-point chunks start below the binary point.
+    namespace detail = gmpxx_transcendent_detail;
+    mp_bitcnt_t prec = static_cast<mp_bitcnt_t>(2048);
+    for (char const* text : {"0.7", "-0.31", "0.123456789", "1e-30", "-0.77"}) {
+        mpf_class x = parse_decimal_literal(text, prec);
+        mpf_class split(0, prec);
+        mpf_class series(0, prec);
+        detail::exp_bit_burst(split.get_mpf_t(), x.get_mpf_t(), prec);
+        detail::expm1_halved(series.get_mpf_t(), x.get_mpf_t(), prec);
+        series += 1;
+        assert_within_ulp(split, series, prec - 8);
+
+        mpf_class split_cos(0, prec);
+        mpf_class series_cos(0, prec);
+        detail::sincos_bit_burst(split.get_mpf_t(), split_cos.get_mpf_t(),
+                                 x.get_mpf_t(), prec);
+        detail::sincos_halved(series.get_mpf_t(), series_cos.get_mpf_t(),
+                              x.get_mpf_t(), prec);
+        assert_within_ulp(split, series, prec - 8);
+        assert_within_ulp(split_cos, series_cos, prec - 8);
+
+        mpf_class y = abs(x) / 2;
+        detail::atan_bit_burst(split.get_mpf_t(), y.get_mpf_t(), prec);
+        detail::atan_taylor_small(series.get_mpf_t(), y.get_mpf_t(), prec);
+        assert_within_ulp(split, series, prec - 8);
+    }
+
+    // 2k (2k + 1) passes 2^32 for k > 23170; where unsigned long is 32 bits
+    // (the _llp64 build), the sine ratios keep the two factors apart.
+    const detail::series_ratio ratio =
+        detail::reciprocal_product_ratio(2ul * 50000ul, 2ul * 50000ul + 1ul);
+    assert(ratio.numerator == 1ul);
+    assert(static_cast<std::uint64_t>(ratio.denominator) * ratio.denominator_factor ==
+           std::uint64_t{100000} * 100001u);
+
+    // The public functions switch above binary_splitting_precision.
+    const mp_bitcnt_t low = detail::binary_splitting_precision;
+    assert_precision_doubling(exp, "-2.3", low, 2 * low);
+    assert_precision_doubling(sin, "2.3", low, 2 * low, 4);
+    assert_precision_doubling(cos, "2.3", low, 2 * low, 4);
+    assert_precision_doubling(atan, "3.7", low, 2 * low, 4);
+}
+
+void test_chudnovsky_pi() {
+    // The Chudnovsky series agrees with Gauss-Legendre, and a state that
+    // extends its sums to a higher precision matches a fresh one.
+    namespace detail = gmpxx_transcendent_detail;
+    for (mp_bitcnt_t prec : {mp_bitcnt_t{64}, mp_bitcnt_t{1024}, mp_bitcnt_t{20000}}) {
+        mpf_class chudnovsky = detail::compute_pi(prec);
+        mpf_class agm = detail::compute_pi_gauss_legendre(prec);
+        assert_within_ulp(chudnovsky, agm, prec, 2);
+    }
+
+    detail::chudnovsky_pi_state growing;
+    mpf_class low = growing.pi(4096);
+    const unsigned long low_terms = growing.terms();
+    mpf_class extended = growing.pi(30000);
+    assert(growing.terms() > low_terms);
+    detail::chudnovsky_pi_state fresh;
+    mpf_class direct = fresh.pi(30000);
+    assert(growing.terms() == fresh.terms());
+    assert(extended == direct);
+    assert_within_ulp(low, direct, 4096, 2);
+
+    // A lower precision reuses the sums without adding terms.
+    mpf_class again = growing.pi(2048);
+    assert(growing.terms() == fresh.terms());
+    assert_within_ulp(again, direct, 2048, 2);
+}
+
+void test_constant_warm_up() {
+    // warm_constants fills the constant caches above the precision of a
+    // call, synchronously or on a background thread, and the functions
+    // read the warmed values.
+    namespace detail = gmpxx_transcendent_detail;
+    const mp_bitcnt_t prec =
+        std::max(detail::pi_cache().cached_precision(),
+                 detail::log_two_cache().cached_precision()) + 64;
+    warm_constants(prec, {transcendental_constant::e,
+                          transcendental_constant::log10});
+    assert(detail::e_cache().cached_precision() > prec);
+    assert(detail::log_ten_cache().cached_precision() > prec);
+    assert_within_ulp(e(prec), exp(mpf_class(1, prec)), prec);
+    assert_within_ulp(log_ten(prec), log(mpf_class(10, prec)), prec);
+
+    std::future<void> pending = warm_constants_async(
+        prec, {transcendental_constant::pi, transcendental_constant::log2,
+               transcendental_constant::trig});
+    mpf_class x = parse_decimal_literal("0.7", prec);
+    mpf_class concurrent = sin(x);
+    pending.get();
+    assert(detail::pi_cache().cached_precision() > prec);
+    assert(detail::log_two_cache().cached_precision() > prec);
+    assert(detail::trig_constant_cache().cached_precision() >
+           detail::trig_constant_precision(prec));
+    assert_within_ulp(sin(x), concurrent, prec);
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+void test_persistent_constants() {
+    // Constants round-trip through the GMPXX_MKII_CONSTANT_CACHE directory:
+    // a file serves any precision up to its own without recomputation, and
+    // a damaged, foreign or less precise file is recomputed and replaced.
+    namespace detail = gmpxx_transcendent_detail;
+    char directory[] = "/tmp/gmpxx_mkII_constantsXXXXXX";
+    if (mkdtemp(directory) == nullptr ||
+        setenv("GMPXX_MKII_CONSTANT_CACHE", directory, 1) != 0) {
+        return;
+    }
+    const std::string path = detail::constant_file_path("pi");
+
+    int computed = 0;
+    const auto compute = [&computed](detail::precision_type precision) {
+        ++computed;
+        return detail::compute_pi_gauss_legendre(precision);
+    };
+    const mpf_class stored = detail::persisted_constant("pi", 2048, compute);
+    assert(computed == 1);
+    assert(detail::stored_constant_precision(path) == 2048);
+    assert_within_ulp(detail::persisted_constant("pi", 2048, compute), stored,
+                      2048);
+    assert_within_ulp(detail::persisted_constant("pi", 1000, compute), stored,
+                      1000);
+    assert(computed == 1);
+
+    detail::persisted_constant("pi", 4096, compute);
+    assert(computed == 2);
+    assert(detail::stored_constant_precision(path) == 4096);
+
+    std::FILE* file = std::fopen(path.c_str(), "r+b");
+    if (file == nullptr) {
+        assert(false);
+        return;
+    }
+    std::fseek(file, -1, SEEK_END);
+    const int last = std::fgetc(file);
+    std::fseek(file, -1, SEEK_END);
+    std::fputc(last ^ 1, file);
+    std::fclose(file);
+    const mpf_class repaired = detail::persisted_constant("pi", 4096, compute);
+    assert(computed == 3);
+    assert_within_ulp(repaired, pi(4096), 4096);
+    detail::persisted_constant("pi", 4096, compute);
+    assert(computed == 3);
+
+    // Bytes after the last limb mark the file as damaged too.
+    file = std::fopen(path.c_str(), "ab");
+    if (file == nullptr) {
+        assert(false);
+        return;
+    }
+    std::fputc(0, file);
+    std::fclose(file);
+    detail::persisted_constant("pi", 4096, compute);
+    assert(computed == 4);
+
+    file = std::fopen(path.c_str(), "wb");
+    if (file == nullptr) {
+        assert(false);
+        return;
+    }
+    std::fputs("not a constant file", file);
+    std::fclose(file);
+    detail::persisted_constant("pi", 256, compute);
+    assert(computed == 5);
+    assert(detail::stored_constant_precision(path) == 256);
+
+    unsetenv("GMPXX_MKII_CONSTANT_CACHE");
+    assert(detail::constant_file_path("pi").empty());
+    std::remove(path.c_str());
+    rmdir(directory);
+}
+#endif
+
+void test_workspace_reuse_across_precisions() {
+    // The kernels reuse per-thread registers.  Narrowing them for a low
+    // precision call and widening them again must not change any result.
+    auto evaluate = [](mp_bitcnt_t prec) {
+        mpf_class x =
+            parse_decimal_literal("0.739085133215160641655312087673873", prec);
+        mpf_class y = parse_decimal_literal("12.5", prec);
+        return std::array<mpf_class, 5>{exp(x), log(y), sin(y), cos(y), atan(y)};
+    };
+    auto const reference_128 = evaluate(128);
+    auto const reference_1024 = evaluate(1024);
+    for (mp_bitcnt_t prec : {mp_bitcnt_t{1024}, mp_bitcnt_t{128},
+                             mp_bitcnt_t{2048}, mp_bitcnt_t{1024},
+                             mp_bitcnt_t{128}}) {
+        auto const values = evaluate(prec);
+        if (prec == 128 || prec == 1024) {
+            auto const& reference = prec == 128 ? reference_128 : reference_1024;
+            for (std::size_t i = 0; i < values.size(); ++i) {
+                assert(cmp(values[i], reference[i]) == 0);
+            }
+        }
+    }
+
+    // A throwing call hands its registers back.
+    bool threw = false;
+    try {
+        (void)log(mpf_class(-1, 256));
+    } catch (std::domain_error const&) {
+        threw = true;
+    }
+    assert(threw);
+    assert(gmpxx_transcendent_detail::thread_workspace().floats_used() == 0);
+    assert(gmpxx_transcendent_detail::thread_workspace().integers_used() == 0);
+}
+
 }  // namespace
 
 int main() {
@@ -552,5 +958,16 @@ int main() {
     test_pow_integer_and_domain_cases();
     test_precision_policy();
     test_domain_errors();
+    test_high_precision_series();
+    test_argument_halving();
+    test_log_tables();
+    test_log_tables_release();
+    test_binary_splitting();
+    test_chudnovsky_pi();
+    test_constant_warm_up();
+#if defined(__unix__) || defined(__APPLE__)
+    test_persistent_constants();
+#endif
+    test_workspace_reuse_across_precisions();
     return 0;
 }
@@ -354,12 +354,55 @@ void test_branch_cut_identities_with_mpf() {
                      tolerance);
 }
 
+void test_sincos() {
+    using namespace gmpxx;
+
+    std::vector<complex_ref> values = {
+        complex_ref(0.25, -0.5),
+        complex_ref(-1.5, 0.75),
+        complex_ref(3.0, -2.0),
+    };
+    for (complex_ref ref : values) {
+        mpfc_class z = make_mpfc(ref.real(), ref.imag());
+        auto [sin_z, cos_z] = sincos(z);
+        check_close("sincos sin", std::sin(ref), sin_z);
+        check_close("sincos cos", std::cos(ref), cos_z);
+        check_close_mpfc(sin(z), sin_z, branch_epsilon(256));
+        check_close_mpfc(cos(z), cos_z, branch_epsilon(256));
+        check_close_mpfc(mpfc_class(mpf_class(1, 256), mpf_class(0, 256)),
+                         sin_z * sin_z + cos_z * cos_z, branch_epsilon(256));
+    }
+
+    // A tiny imaginary part keeps its relative accuracy in sinh.
+    mpf_class tiny("1e-30", 256);
+    mpfc_class near_real(mpf_class("0.5", 256), tiny);
+    mpf_class sinh_tiny = tiny + tiny * tiny * tiny / 6;
+    mpf_class expected = cos(mpf_class("0.5", 256)) * sinh_tiny;
+    mpf_class relative = abs(sin(near_real).imag() / expected - 1);
+    mpf_class bound(1, 256);
+    mpf_div_2exp(bound.get_mpf_t(), bound.get_mpf_t(), 240);
+    assert(relative < bound);
+
+    mpfc_class w(mpf_class("-0.125", 256), mpf_class("0.375", 256));
+    auto [sin_sum, cos_sum] = sincos(near_real + w);
+    check_close("sincos expression sin", std::sin(complex_ref(0.375, 0.375)),
+                sin_sum);
+    check_close("sincos expression cos", std::cos(complex_ref(0.375, 0.375)),
+                cos_sum);
+
+    mpfc_class rotated = polar(mpf_class(2, 256), mpf_class("0.75", 256));
+    auto [sin_angle, cos_angle] = sincos(mpf_class("0.75", 256));
+    assert(rotated.real() == mpf_class(2, 256) * cos_angle);
+    assert(rotated.imag() == mpf_class(2, 256) * sin_angle);
+}
+
 }  // namespace
 
 int main() {
     test_primary_functions_against_std_complex();
     test_inverse_functions_against_std_complex();
     test_real_axis_and_expression_inputs();
+    test_sincos();
     test_gamma_functions();
     test_pow_against_std_complex();
     test_branch_cuts_against_std_complex();
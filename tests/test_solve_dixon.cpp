@@ -0,0 +1,161 @@
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include <gmpxx_mkII.h>
+
+namespace {
+
+// Deterministic signed entries of up to about 60 bits.
+std::vector<gmpxx::mpz_class> make_integers(std::size_t count, unsigned seed,
+                                            int shift) {
+    std::vector<gmpxx::mpz_class> values;
+    std::uint64_t state = 0x9E3779B97F4A7C15ULL * (seed + 1);
+    for (std::size_t i = 0; i < count; ++i) {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        std::int64_t v = static_cast<std::int64_t>(state >> shift);
+        values.emplace_back(state & 1 ? -v : v);
+    }
+    return values;
+}
+
+template<class Scalar>
+void check_solution(std::vector<Scalar> const& a, std::vector<Scalar> const& b,
+                    std::vector<gmpxx::mpq_class> const& x) {
+    const std::size_t n = b.size();
+    assert(x.size() == n);
+    for (std::size_t i = 0; i < n; ++i) {
+        gmpxx::mpq_class sum(0);
+        for (std::size_t j = 0; j < n; ++j) {
+            sum += gmpxx::mpq_class(a[i + j * n]) * x[j];
+        }
+        assert(sum == gmpxx::mpq_class(b[i]));
+    }
+}
+
+void test_small_system() {
+    // [2 1; 1 3] x = [1; 2] has x = [1/5; 3/5].
+    std::vector<gmpxx::mpz_class> a = {gmpxx::mpz_class(2), gmpxx::mpz_class(1),
+                                       gmpxx::mpz_class(1), gmpxx::mpz_class(3)};
+    std::vector<gmpxx::mpz_class> b = {gmpxx::mpz_class(1), gmpxx::mpz_class(2)};
+    gmpxx::dixon_info info;
+    std::vector<gmpxx::mpq_class> x = gmpxx::solve_dixon(a, b, &info);
+    assert(x[0] == gmpxx::mpq_class(1, 5));
+    assert(x[1] == gmpxx::mpq_class(3, 5));
+    assert(info.prime == 2147483647ul);
+    assert(info.lifting_steps >= 1);
+}
+
+void test_random_integer_systems() {
+    const std::size_t sizes[] = {1, 3, 8, 25};
+    const int shifts[] = {60, 40, 4};
+    for (std::size_t n : sizes) {
+        for (int shift : shifts) {
+            std::vector<gmpxx::mpz_class> a = make_integers(n * n, static_cast<unsigned>(n), shift);
+            std::vector<gmpxx::mpz_class> b = make_integers(n, 99, shift);
+            for (std::size_t i = 0; i < n; ++i) {
+                a[i + i * n] += 1;
+            }
+            check_solution(a, b, gmpxx::solve_dixon(a, b));
+        }
+    }
+}
+
+// A = [1 0; 0 0] (mod p) for the first prime, so the factorization has to
+// move on to the next one.
+void test_prime_retry() {
+    const gmpxx::mpz_class p(std::uint64_t{2147483647});
+    std::vector<gmpxx::mpz_class> a = {p + 1, p, p, p};
+    std::vector<gmpxx::mpz_class> b = {gmpxx::mpz_class(5), gmpxx::mpz_class(-7)};
+    gmpxx::dixon_info info;
+    std::vector<gmpxx::mpq_class> x = gmpxx::solve_dixon(a, b, &info);
+    assert(info.prime != 2147483647ul);
+    check_solution(a, b, x);
+}
+
+// The product of 2^31 - 1 and the seven primes below it vanishes modulo
+// every fixed candidate, so only the random primes or the exact singularity
+// check can tell that [P] and diag(P, 1) are nonsingular.
+void test_adversarial_primes() {
+    gmpxx::mpz_class product(1);
+    gmpxx::mpz_class prime(std::uint64_t{2147483647});
+    for (int found = 0; found < 8; prime -= 2) {
+        if (mpz_probab_prime_p(prime.get_mpz_t(), 25) != 0) {
+            product *= prime;
+            ++found;
+        }
+    }
+
+    std::vector<gmpxx::mpz_class> a = {product};
+    std::vector<gmpxx::mpz_class> b = {gmpxx::mpz_class(1)};
+    gmpxx::dixon_info info;
+    std::vector<gmpxx::mpq_class> x = gmpxx::solve_dixon(a, b, &info);
+    assert(x[0] == gmpxx::mpq_class(gmpxx::mpz_class(1), product));
+    assert(mpz_fdiv_ui(product.get_mpz_t(), info.prime) != 0);
+
+    a = {product, gmpxx::mpz_class(0), gmpxx::mpz_class(0), gmpxx::mpz_class(1)};
+    b = {gmpxx::mpz_class(3), gmpxx::mpz_class(-4)};
+    x = gmpxx::solve_dixon(a, b);
+    check_solution(a, b, x);
+    assert(x[1] == -4);
+}
+
+void test_rational_system() {
+    const std::size_t n = 6;
+    std::vector<gmpxx::mpz_class> num = make_integers(n * n, 7, 50);
+    std::vector<gmpxx::mpz_class> den = make_integers(n * n, 8, 54);
+    std::vector<gmpxx::mpq_class> a(n * n);
+    for (std::size_t k = 0; k < n * n; ++k) {
+        a[k] = gmpxx::mpq_class(num[k], abs(den[k]) + 1);
+    }
+    std::vector<gmpxx::mpq_class> b = {
+        gmpxx::mpq_class(1, 3), gmpxx::mpq_class(-2, 7), gmpxx::mpq_class(0),
+        gmpxx::mpq_class(5), gmpxx::mpq_class(11, 13), gmpxx::mpq_class(-1, 2)};
+    check_solution(a, b, gmpxx::solve_dixon(a, b));
+}
+
+void test_trivial_and_errors() {
+    assert(gmpxx::solve_dixon(std::vector<gmpxx::mpz_class>{},
+                              std::vector<gmpxx::mpz_class>{}).empty());
+    std::vector<gmpxx::mpz_class> a = make_integers(9, 1, 40);
+    std::vector<gmpxx::mpz_class> zero(3, gmpxx::mpz_class(0));
+    for (gmpxx::mpq_class const& v : gmpxx::solve_dixon(a, zero)) {
+        assert(v == 0);
+    }
+
+    bool thrown = false;
+    try {
+        (void)gmpxx::solve_dixon(a, std::vector<gmpxx::mpz_class>(2));
+    } catch (std::invalid_argument const&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    // Third column = first + second.
+    for (std::size_t i = 0; i < 3; ++i) {
+        a[i + 6] = a[i] + a[i + 3];
+    }
+    thrown = false;
+    try {
+        (void)gmpxx::solve_dixon(a, make_integers(3, 2, 40));
+    } catch (std::domain_error const&) {
+        thrown = true;
+    }
+    assert(thrown);
+}
+
+}  // namespace
+
+int main() {
+    test_small_system();
+    test_random_integer_systems();
+    test_prime_retry();
+    test_adversarial_primes();
+    test_rational_system();
+    test_trivial_and_errors();
+    return 0;
+}
@@ -0,0 +1,154 @@
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <cassert>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include <gmpxx_mkII.h>
+
+namespace {
+
+std::vector<gmpxx::mpf_class> make_values(std::size_t n, mp_bitcnt_t prec,
+                                          unsigned seed) {
+    std::vector<gmpxx::mpf_class> values;
+    values.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        gmpxx::mpf_class value(0, prec);
+        mpf_set_ui(value.get_mpf_t(), static_cast<unsigned long>(
+                                          (i * 2654435761u + seed) % 1000003u));
+        mpf_div_ui(value.get_mpf_t(), value.get_mpf_t(), 1000003u);
+        if ((i + seed) % 3 == 0) {
+            value = -value;
+        }
+        values.push_back(value);
+    }
+    return values;
+}
+
+// max_i |b_i - (A x)_i| <= 2^-bits * max_i |b_i|, evaluated exactly enough.
+void check_residual(std::vector<gmpxx::mpf_class> const& a,
+                    std::vector<gmpxx::mpf_class> const& b,
+                    std::vector<gmpxx::mpf_class> const& x, mp_bitcnt_t bits) {
+    const std::size_t n = b.size();
+    const mp_bitcnt_t wide = 4 * bits + 256;
+    gmpxx::mpf_class worst(0, wide);
+    gmpxx::mpf_class scale(0, wide);
+    for (std::size_t i = 0; i < n; ++i) {
+        gmpxx::mpf_class r(b[i], wide);
+        gmpxx::mpf_class product(0, wide);
+        for (std::size_t j = 0; j < n; ++j) {
+            mpf_mul(product.get_mpf_t(), a[i + j * n].get_mpf_t(), x[j].get_mpf_t());
+            r -= product;
+        }
+        if (abs(r) > worst) {
+            worst = abs(r);
+        }
+        if (abs(b[i]) > scale) {
+            scale = abs(b[i]);
+        }
+    }
+    mpf_div_2exp(scale.get_mpf_t(), scale.get_mpf_t(), bits);
+    assert(worst <= scale);
+}
+
+// Diagonally weighted so the system is well conditioned.
+std::vector<gmpxx::mpf_class> make_matrix(std::size_t n, mp_bitcnt_t prec) {
+    std::vector<gmpxx::mpf_class> a = make_values(n * n, prec, 11);
+    for (std::size_t i = 0; i < n; ++i) {
+        a[i + i * n] += 4;
+    }
+    return a;
+}
+
+void test_well_conditioned() {
+    const std::size_t n = 40;
+    const mp_bitcnt_t precisions[] = {32, 64, 256, 1024};
+    for (mp_bitcnt_t prec : precisions) {
+        std::vector<gmpxx::mpf_class> a = make_matrix(n, prec);
+        std::vector<gmpxx::mpf_class> b = make_values(n, prec, 5);
+        gmpxx::refinement_info info;
+        std::vector<gmpxx::mpf_class> x = gmpxx::solve_refined(a, b, prec, &info);
+        assert(x.size() == n);
+        assert(mpf_get_prec(x[0].get_mpf_t()) >= prec);
+        assert(info.factorizations == 1);
+        assert(info.factor_prec == 53);
+        assert(info.iterations >= 1);
+        check_residual(a, b, x, prec - 8);
+    }
+}
+
+// Hilbert matrices are too ill-conditioned for a double factorization
+// beyond n = 12 and force the escalation.
+void test_escalation() {
+    const std::size_t n = 16;
+    const mp_bitcnt_t prec = 512;
+    std::vector<gmpxx::mpf_class> a(n * n);
+    std::vector<gmpxx::mpf_class> b(n, gmpxx::mpf_class(1, prec));
+    for (std::size_t j = 0; j < n; ++j) {
+        for (std::size_t i = 0; i < n; ++i) {
+            a[i + j * n] = gmpxx::mpf_class(1, prec);
+            a[i + j * n] /= static_cast<unsigned long>(i + j + 1);
+        }
+    }
+    gmpxx::refinement_info info;
+    std::vector<gmpxx::mpf_class> x = gmpxx::solve_refined(a, b, prec, &info);
+    assert(info.factorizations >= 2);
+    assert(info.factor_prec > 53);
+    check_residual(a, b, x, prec - 64);
+}
+
+// Entries beyond the double exponent range skip the double factorization.
+void test_wide_exponents() {
+    const std::size_t n = 6;
+    const mp_bitcnt_t prec = 256;
+    std::vector<gmpxx::mpf_class> a = make_matrix(n, prec);
+    std::vector<gmpxx::mpf_class> b = make_values(n, prec, 3);
+    for (gmpxx::mpf_class& v : a) {
+        mpf_mul_2exp(v.get_mpf_t(), v.get_mpf_t(), 5000);
+    }
+    gmpxx::refinement_info info;
+    std::vector<gmpxx::mpf_class> x = gmpxx::solve_refined(a, b, prec, &info);
+    assert(info.factor_prec > 53);
+    check_residual(a, b, x, prec - 8);
+}
+
+void test_trivial_and_errors() {
+    gmpxx::refinement_info info;
+    assert(gmpxx::solve_refined({}, {}, 128, &info).empty());
+    assert(info.iterations == 0);
+
+    std::vector<gmpxx::mpf_class> a = make_matrix(3, 128);
+    std::vector<gmpxx::mpf_class> zero(3, gmpxx::mpf_class(0, 128));
+    std::vector<gmpxx::mpf_class> x = gmpxx::solve_refined(a, zero, 128);
+    for (gmpxx::mpf_class const& v : x) {
+        assert(v == 0);
+    }
+
+    bool thrown = false;
+    try {
+        (void)gmpxx::solve_refined(a, std::vector<gmpxx::mpf_class>(2), 128);
+    } catch (std::invalid_argument const&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    std::vector<gmpxx::mpf_class> singular(4, gmpxx::mpf_class(1, 128));
+    thrown = false;
+    try {
+        (void)gmpxx::solve_refined(singular, make_values(2, 128, 1), 128);
+    } catch (std::domain_error const&) {
+        thrown = true;
+    }
+    assert(thrown);
+}
+
+}  // namespace
+
+int main() {
+    test_well_conditioned();
+    test_escalation();
+    test_wide_exponents();
+    test_trivial_and_errors();
+    return 0;
+}
@@ -0,0 +1,206 @@
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <cassert>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <gmpxx_mkII.h>
+
+namespace {
+
+constexpr mp_bitcnt_t test_prec = 256;
+
+using dense = std::vector<std::vector<gmpxx::mpf_class>>;
+
+gmpxx::mpf_class make_value(std::size_t seed) {
+    gmpxx::mpf_class value(0, test_prec);
+    mpf_set_ui(value.get_mpf_t(),
+               static_cast<unsigned long>((seed * 2654435761u) % 1000003u));
+    mpf_div_ui(value.get_mpf_t(), value.get_mpf_t(), 7919u);
+    if (seed % 3 == 0) {
+        value = -value;
+    }
+    return value;
+}
+
+// Pseudo-random pattern with some duplicated positions.
+std::vector<gmpxx::sparse_entry> make_entries(std::size_t rows, std::size_t cols,
+                                              std::size_t count, dense& reference) {
+    reference.assign(rows, std::vector<gmpxx::mpf_class>(
+                               cols, gmpxx::mpf_class(0, test_prec)));
+    std::vector<gmpxx::sparse_entry> entries;
+    for (std::size_t k = 0; k < count; ++k) {
+        std::size_t i = (k * 37 + 11) % rows;
+        std::size_t j = (k * k * 13 + 5) % cols;
+        gmpxx::mpf_class value = make_value(k + 1);
+        reference[i][j] += value;
+        entries.push_back({i, j, value});
+    }
+    return entries;
+}
+
+std::vector<gmpxx::mpf_class> make_vector(std::size_t n, std::size_t seed) {
+    std::vector<gmpxx::mpf_class> values;
+    for (std::size_t i = 0; i < n; ++i) {
+        values.push_back(make_value(i + seed));
+    }
+    return values;
+}
+
+void check_close(std::vector<gmpxx::mpf_class> const& expected,
+                 std::vector<gmpxx::mpf_class> const& actual) {
+    assert(expected.size() == actual.size());
+    gmpxx::mpf_class bound(1, test_prec);
+    mpf_div_2exp(bound.get_mpf_t(), bound.get_mpf_t(), test_prec - 32);
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+        gmpxx::mpf_class error(expected[i] - actual[i], test_prec);
+        assert(abs(error) <= bound);
+    }
+}
+
+void test_slab() {
+    gmpxx::mpf_slab slab(5, test_prec);
+    assert(slab.size() == 5);
+    assert(slab.get_prec() == test_prec);
+    assert(mpf_get_prec(slab.get_mpf_t(4)) >= test_prec);
+    assert(slab.get(3) == 0);
+
+    gmpxx::mpf_class third(1, test_prec);
+    third /= 3;
+    slab.set(2, third);
+    mpf_mul(slab.get_mpf_t(4), slab.get_mpf_t(2), slab.get_mpf_t(2));
+    gmpxx::mpf_class ninth(third * third, test_prec);
+    assert(slab.get(2) == third);
+    assert(slab.get(4) == ninth);
+
+    gmpxx::mpf_slab copy(slab);
+    slab.set(2, gmpxx::mpf_class(7, test_prec));
+    assert(copy.get(2) == third);
+    gmpxx::mpf_slab moved(std::move(copy));
+    assert(moved.get(4) == ninth);
+}
+
+void test_structure() {
+    std::vector<gmpxx::sparse_entry> entries = {
+        {2, 0, gmpxx::mpf_class(3, test_prec)},
+        {0, 1, gmpxx::mpf_class(1, test_prec)},
+        {0, 1, gmpxx::mpf_class(2, test_prec)},
+        {1, 2, gmpxx::mpf_class(4, test_prec)},
+        {0, 0, gmpxx::mpf_class(5, test_prec)},
+    };
+    gmpxx::csr_matrix a(3, 3, entries, test_prec);
+    assert(a.rows() == 3 && a.cols() == 3);
+    assert(a.nonzeros() == 4);
+    assert((a.pointers() == std::vector<std::size_t>{0, 2, 3, 4}));
+    assert((a.indices() == std::vector<std::size_t>{0, 1, 2, 0}));
+    assert(a.values().get(1) == 3);
+
+    gmpxx::csc_matrix b(3, 3, entries, test_prec);
+    assert((b.pointers() == std::vector<std::size_t>{0, 2, 3, 4}));
+    assert((b.indices() == std::vector<std::size_t>{0, 2, 0, 1}));
+    assert(b.values().get(2) == 3);
+}
+
+template<class Matrix>
+void check_products(Matrix const& a, dense const& reference) {
+    const std::size_t rows = reference.size();
+    const std::size_t cols = reference[0].size();
+    std::vector<gmpxx::mpf_class> x = make_vector(cols, 3);
+    std::vector<gmpxx::mpf_class> xt = make_vector(rows, 5);
+    gmpxx::mpf_class alpha(-1.5, test_prec);
+    gmpxx::mpf_class beta(0.25, test_prec);
+
+    std::vector<gmpxx::mpf_class> y = make_vector(rows, 7);
+    std::vector<gmpxx::mpf_class> expected(rows);
+    for (std::size_t i = 0; i < rows; ++i) {
+        gmpxx::mpf_class sum(0, test_prec);
+        for (std::size_t j = 0; j < cols; ++j) {
+            sum += reference[i][j] * x[j];
+        }
+        expected[i] = gmpxx::mpf_class(alpha * sum + beta * y[i], test_prec);
+    }
+    a.spmv(alpha, x, beta, y);
+    check_close(expected, y);
+
+    std::vector<gmpxx::mpf_class> yt = make_vector(cols, 9);
+    std::vector<gmpxx::mpf_class> expected_t(cols);
+    for (std::size_t j = 0; j < cols; ++j) {
+        gmpxx::mpf_class sum(0, test_prec);
+        for (std::size_t i = 0; i < rows; ++i) {
+            sum += reference[i][j] * xt[i];
+        }
+        expected_t[j] = gmpxx::mpf_class(alpha * sum + beta * yt[j], test_prec);
+    }
+    a.spmv_transposed(alpha, xt, beta, yt);
+    check_close(expected_t, yt);
+
+    std::vector<gmpxx::mpf_class> plain(rows, gmpxx::mpf_class(0, test_prec));
+    a.spmv(x, plain);
+    std::vector<gmpxx::mpf_class> scaled(rows, gmpxx::mpf_class(0, test_prec));
+    a.spmv(gmpxx::mpf_class(1, test_prec), x, gmpxx::mpf_class(0, test_prec), scaled);
+    for (std::size_t i = 0; i < rows; ++i) {
+        assert(plain[i] == scaled[i]);
+    }
+}
+
+void test_products() {
+    dense reference;
+    std::vector<gmpxx::sparse_entry> entries = make_entries(47, 31, 400, reference);
+    gmpxx::csr_matrix a(47, 31, entries, test_prec);
+    gmpxx::csc_matrix b(47, 31, entries, test_prec);
+    assert(a.nonzeros() == b.nonzeros());
+    check_products(a, reference);
+    check_products(b, reference);
+
+    gmpxx::csr_matrix copy = a;
+    check_products(copy, reference);
+}
+
+void test_empty_rows() {
+    dense reference(4, std::vector<gmpxx::mpf_class>(
+                           6, gmpxx::mpf_class(0, test_prec)));
+    reference[2][5] = gmpxx::mpf_class(2, test_prec);
+    std::vector<gmpxx::sparse_entry> entries = {{2, 5, reference[2][5]}};
+    check_products(gmpxx::csr_matrix(4, 6, entries, test_prec), reference);
+    check_products(gmpxx::csc_matrix(4, 6, entries, test_prec), reference);
+}
+
+void test_errors() {
+    bool thrown = false;
+    try {
+        gmpxx::csr_matrix bad(2, 2, {{2, 0, gmpxx::mpf_class(1)}}, test_prec);
+    } catch (std::out_of_range const&) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    gmpxx::csc_matrix a(3, 2, {{0, 0, gmpxx::mpf_class(1)}}, test_prec);
+    std::vector<gmpxx::mpf_class> x(3), y(3);
+    thrown = false;
+    try {
+        a.spmv(x, y);
+    } catch (std::invalid_argument const&) {
+        thrown = true;
+    }
+    assert(thrown);
+    thrown = false;
+    try {
+        a.spmv_transposed(x, y);
+    } catch (std::invalid_argument const&) {
+        thrown = true;
+    }
+    assert(thrown);
+}
+
+}  // namespace
+
+int main() {
+    test_slab();
+    test_structure();
+    test_products();
+    test_empty_rows();
+    test_errors();
+    return 0;
+}
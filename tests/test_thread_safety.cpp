@@ -30,7 +30,9 @@
 
 #include <atomic>
 #include <cassert>
+#include <chrono>
 #include <cstdint>
+#include <iostream>
 #include <thread>
 #include <vector>
 
@@ -110,10 +112,107 @@ void test_snapshot_semantics() {
     t.join();
 }
 
+struct constant_results {
+    mp_bitcnt_t prec;
+    mpf_class pi_value;
+    mpf_class log_two_value;
+    mpf_class sin_value;
+};
+
+bool close_to(mpf_class const& value, mpf_class const& reference, mp_bitcnt_t prec) {
+    mpf_class tolerance(1, 2 * prec);
+    mpf_div_2exp(tolerance.get_mpf_t(), tolerance.get_mpf_t(), prec - 2);
+    mpf_class diff(0, 2 * prec);
+    mpf_sub(diff.get_mpf_t(), value.get_mpf_t(), reference.get_mpf_t());
+    mpf_abs(diff.get_mpf_t(), diff.get_mpf_t());
+    return value.get_prec() >= prec && diff <= tolerance;
+}
+
+// Threads released together ask for pi, log 2, and sin at rising
+// precisions, so cache misses race each other and the lock-free hits.
+void test_constant_cache_race() {
+    constexpr int thread_count = 8;
+    constexpr int rounds = 6;
+    std::atomic<bool> go{false};
+    std::vector<std::vector<constant_results>> results(thread_count);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < thread_count; ++i) {
+        threads.emplace_back([&, i] {
+            while (!go.load()) {
+                std::this_thread::yield();
+            }
+            for (int round = 0; round < rounds; ++round) {
+                const mp_bitcnt_t prec =
+                    static_cast<mp_bitcnt_t>(128 + 96 * round + 8 * i);
+                results[i].push_back({prec, gmpxx::pi(prec), gmpxx::log_two(prec),
+                                      sin(mpf_class(1, prec))});
+            }
+        });
+    }
+    go = true;
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    constexpr mp_bitcnt_t reference_prec = 1024;
+    const mpf_class pi_ref = gmpxx::pi(reference_prec);
+    const mpf_class log_two_ref = gmpxx::log_two(reference_prec);
+    const mpf_class sin_ref = sin(mpf_class(1, reference_prec));
+    for (auto const& per_thread : results) {
+        assert(per_thread.size() == rounds);
+        for (auto const& r : per_thread) {
+            assert(close_to(r.pi_value, pi_ref, r.prec));
+            assert(close_to(r.log_two_value, log_two_ref, r.prec));
+            assert(close_to(r.sin_value, sin_ref, r.prec));
+        }
+    }
+}
+
+// Contention on cache hits: every call finds a snapshot that is precise
+// enough.  The hits take no lock, so on a machine with enough cores the
+// reported wall time per call falls as threads are added, instead of
+// staying flat behind a mutex.
+void test_constant_cache_contention() {
+    constexpr mp_bitcnt_t prec = 256;
+    constexpr int calls = 2000;
+    const mpf_class pi_ref = gmpxx::pi(prec);
+    const mpf_class log_two_ref = gmpxx::log_two(prec);
+    const mpf_class sin_ref = sin(mpf_class(1, prec));
+
+    for (int thread_count : {1, 4, 16}) {
+        std::atomic<int> mismatches{0};
+        std::vector<std::thread> threads;
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < thread_count; ++i) {
+            threads.emplace_back([&] {
+                for (int k = 0; k < calls; ++k) {
+                    if (gmpxx::pi(prec) != pi_ref || gmpxx::log_two(prec) != log_two_ref) {
+                        ++mismatches;
+                    }
+                }
+                if (sin(mpf_class(1, prec)) != sin_ref) {
+                    ++mismatches;
+                }
+            });
+        }
+        for (auto& t : threads) {
+            t.join();
+        }
+        const std::chrono::duration<double, std::nano> elapsed =
+            std::chrono::steady_clock::now() - start;
+        assert(mismatches == 0);
+        std::cout << "DIAG: constant cache hits with " << thread_count
+                  << " threads: " << elapsed.count() / (2.0 * calls * thread_count)
+                  << " ns per call" << std::endl;
+    }
+}
+
 int main() {
     test_independent_lazy_init();
     test_isolation_from_gmp_global();
     test_set_before_spawn();
     test_snapshot_semantics();
+    test_constant_cache_race();
+    test_constant_cache_contention();
     return 0;
 }